@@ -0,0 +1,431 @@
+// Syntri Benchmark Suite - Processor and Kernel Throughput
+// Times every built-in processor and sample kernel across channel counts,
+// buffer sizes and sample rates; prints a table and optional JSON
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/audio_interface.h"
+#include "syntri/audio_kernels.h"
+#include "syntri/fused_stages.h"
+#include "syntri/log.h"
+#include "syntri/matrix_mixer.h"
+#include "syntri/rt_thread.h"
+#include "syntri/signal_generator.h"
+#include "syntri/worker_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef SYNTRI_VERSION
+#define SYNTRI_VERSION "unknown"
+#endif
+
+namespace {
+
+    const int CHANNEL_COUNTS[] = { 8, 32, 64 };
+    const int BUFFER_SIZES[] = { Syntri::BUFFER_SIZE_ULTRA_LOW, Syntri::BUFFER_SIZE_LOW, 128, 256 };
+    const int SAMPLE_RATES[] = { Syntri::SAMPLE_RATE_48K, Syntri::SAMPLE_RATE_96K };
+
+    struct BenchOptions {
+        std::string json_path;      // "-" = stdout
+        std::string filter;
+        double min_seconds = 0.05;  // Measured time per case
+    };
+
+    struct BenchResult {
+        std::string name;
+        std::string kind;
+        int channels;
+        int buffer_size;
+        int sample_rate;
+        double ns_per_block;
+        double ns_per_sample;       // Per channel-sample
+        double gb_per_second;       // Bytes the case reads + writes
+        double realtime_headroom;   // Buffer period / processing time
+    };
+
+    // Median time of one call, in ns. Batches are sized so clock overhead is negligible.
+    double measure(const std::function<void()>& body, double min_seconds) {
+        using Clock = std::chrono::steady_clock;
+
+        for (int i = 0; i < 16; ++i) body();
+
+        long long iterations = 1;
+        const double batch_seconds = std::max(min_seconds / 20.0, 1.0e-4);
+        for (;;) {
+            auto start = Clock::now();
+            for (long long i = 0; i < iterations; ++i) body();
+            double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            if (elapsed >= batch_seconds || iterations >= (1LL << 30)) break;
+            iterations *= 2;
+        }
+
+        std::vector<double> samples;
+        const auto deadline = Clock::now() + std::chrono::duration<double>(min_seconds);
+        do {
+            auto start = Clock::now();
+            for (long long i = 0; i < iterations; ++i) body();
+            samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations);
+        } while (Clock::now() < deadline || samples.size() < 5);
+
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    BenchResult makeResult(const std::string& name, const std::string& kind, int channels, int buffer_size,
+        int sample_rate, double ns_per_block, double bytes_per_block) {
+        BenchResult result;
+        result.name = name;
+        result.kind = kind;
+        result.channels = channels;
+        result.buffer_size = buffer_size;
+        result.sample_rate = sample_rate;
+        result.ns_per_block = ns_per_block;
+        result.ns_per_sample = ns_per_block / (static_cast<double>(channels) * buffer_size);
+        result.gb_per_second = bytes_per_block / ns_per_block;     // bytes/ns == GB/s
+        result.realtime_headroom = (1.0e9 * buffer_size / sample_rate) / ns_per_block;
+        return result;
+    }
+
+    void fillNoise(Syntri::AudioBlockStorage& storage) {
+        unsigned state = 0x12345678u;
+        Syntri::AudioBlock block = storage.getBlock();
+        for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+            for (int sample = 0; sample < block.getNumFrames(); ++sample) {
+                state = state * 1664525u + 1013904223u;
+                block.getChannel(ch)[sample] = static_cast<float>(state >> 8) / 16777216.0f - 0.5f;
+            }
+        }
+    }
+
+    // ====================================
+    // Kernels
+    // ====================================
+    struct KernelCase {
+        const char* name;
+        int bytes_per_sample;       // Read + write traffic per channel-sample
+        std::function<void(const Syntri::ConstAudioBlock&, const Syntri::AudioBlock&)> run;
+    };
+
+    // Trim, polarity, fader, balance and meter with non-trivial settings
+    void configureStrip(Syntri::ChannelStripChain& chain) {
+        for (int ch = 0; ch < Syntri::MAX_AUDIO_CHANNELS; ++ch) {
+            chain.stage<Syntri::TrimStage>().setGainDb(ch, -3.0f);
+            chain.stage<Syntri::PolarityStage>().setInverted(ch, ch % 3 == 0);
+            chain.stage<Syntri::GainStage>().setGain(ch, 0.8f);
+        }
+        for (int pair = 0; pair < Syntri::MAX_AUDIO_CHANNELS / 2; ++pair) {
+            chain.stage<Syntri::BalanceStage>().setBalance(pair, 0.25f);
+        }
+    }
+
+    std::shared_ptr<Syntri::ChannelStripChain> stripChain() {
+        auto chain = std::make_shared<Syntri::ChannelStripChain>();
+        configureStrip(*chain);
+        return chain;
+    }
+
+    std::vector<KernelCase> kernelCases() {
+        using namespace Syntri;
+        // In-place gains alternate between calls so values never overflow
+        // (decay is harmless with denormals flushed)
+        return {
+            { "copy", 8, [](const ConstAudioBlock& in, const AudioBlock& out) {
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::copy(in.getChannel(ch), out.getChannel(ch), out.getNumFrames());
+            } },
+            { "clear", 4, [](const ConstAudioBlock&, const AudioBlock& out) {
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::clear(out.getChannel(ch), out.getNumFrames());
+            } },
+            { "copy_with_gain", 8, [](const ConstAudioBlock& in, const AudioBlock& out) {
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::copyWithGain(in.getChannel(ch), out.getChannel(ch), out.getNumFrames(), 0.7f);
+            } },
+            { "apply_gain", 8, [flip = false](const ConstAudioBlock&, const AudioBlock& out) mutable {
+                flip = !flip;
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::applyGain(out.getChannel(ch), out.getNumFrames(), flip ? 0.5f : 2.0f);
+            } },
+            { "apply_gain_ramp", 8, [flip = false](const ConstAudioBlock&, const AudioBlock& out) mutable {
+                flip = !flip;
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::applyGainRamp(out.getChannel(ch), out.getNumFrames(),
+                        flip ? 1.0f : 0.5f, flip ? 0.5f : 1.0f);
+            } },
+            { "mix_accumulate", 12, [](const ConstAudioBlock& in, const AudioBlock& out) {
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::mixAccumulate(in.getChannel(ch), out.getChannel(0), out.getNumFrames(), 0.1f);
+            } },
+            { "mix_accumulate_ramp", 12, [](const ConstAudioBlock& in, const AudioBlock& out) {
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::mixAccumulateRamp(in.getChannel(ch), out.getChannel(0), out.getNumFrames(), 0.1f, 0.2f);
+            } },
+            { "pan_accumulate", 20, [](const ConstAudioBlock& in, const AudioBlock& out) {
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::panAccumulate(in.getChannel(ch), out.getChannel(0), out.getChannel(1),
+                        out.getNumFrames(), 0.6f, 0.8f);
+            } },
+            { "pan_accumulate_ramp", 20, [](const ConstAudioBlock& in, const AudioBlock& out) {
+                for (int ch = 0; ch < out.getNumChannels(); ++ch)
+                    Kernels::panAccumulateRamp(in.getChannel(ch), out.getChannel(0), out.getChannel(1),
+                        out.getNumFrames(), 0.6f, 0.7f, 0.8f, 0.7f);
+            } },
+            { "stage_chain_fused", 8, [chain = stripChain()](const ConstAudioBlock& in, const AudioBlock& out) {
+                chain->process(in, out);
+            } },
+            { "stage_chain_unfused", 8, [chain = stripChain()](const ConstAudioBlock& in, const AudioBlock& out) {
+                chain->processUnfused(in, out);
+            } },
+        };
+    }
+
+    void benchKernels(const BenchOptions& options, std::vector<BenchResult>& results) {
+        for (const KernelCase& kernel : kernelCases()) {
+            const std::string name = std::string("kernel/") + kernel.name;
+            if (name.find(options.filter) == std::string::npos) continue;
+
+            for (int channels : CHANNEL_COUNTS) {
+                for (int buffer_size : BUFFER_SIZES) {
+                    Syntri::AudioBlockStorage inputs(channels, buffer_size);
+                    Syntri::AudioBlockStorage outputs(channels, buffer_size);
+                    fillNoise(inputs);
+                    fillNoise(outputs);
+                    const Syntri::ConstAudioBlock in = static_cast<const Syntri::AudioBlockStorage&>(inputs).getBlock();
+                    const Syntri::AudioBlock out = outputs.getBlock();
+
+                    // Kernel cost does not depend on the rate - time once, report both
+                    double ns = measure([&]() { kernel.run(in, out); }, options.min_seconds);
+                    for (int sample_rate : SAMPLE_RATES) {
+                        results.push_back(makeResult(name, "kernel", channels, buffer_size, sample_rate, ns,
+                            static_cast<double>(kernel.bytes_per_sample) * channels * buffer_size));
+                    }
+                }
+            }
+        }
+    }
+
+    // ====================================
+    // Processors
+    // ====================================
+    struct ProcessorCase {
+        std::string name;
+        std::function<std::unique_ptr<Syntri::AudioProcessor>(int channels)> create;
+    };
+
+    std::vector<ProcessorCase> processorCases(Syntri::RealtimeWorkerPool* pool) {
+        std::vector<ProcessorCase> cases = {
+            { "processor/passthrough", [](int) { return Syntri::createTestProcessor(false); } },
+            { "processor/test_tone", [](int) { return Syntri::createTestProcessor(true); } },
+            // Fixed shapes (8/16/64 channels at 32/64 frames) run the specialized loop
+            { "processor/channel_strip", [](int) {
+                auto strip = std::make_unique<Syntri::FusedStageProcessor<Syntri::TrimStage, Syntri::PolarityStage,
+                    Syntri::GainStage, Syntri::BalanceStage, Syntri::PeakMeterStage>>();
+                configureStrip(strip->getChain());
+                return std::unique_ptr<Syntri::AudioProcessor>(std::move(strip));
+            } },
+            { "processor/pink_noise", [](int) {
+                Syntri::SignalSettings settings;
+                settings.type = Syntri::SignalType::PINK_NOISE;
+                return Syntri::createSignalProcessor(settings);
+            } },
+            // Every input routed to every mix - the worst case for the mixer
+            { "processor/matrix_mixer", [](int channels) {
+                auto mixer = std::make_unique<Syntri::MatrixMixer>(channels, channels / 2);
+                for (int mix = 0; mix < channels / 2; ++mix) {
+                    for (int input = 0; input < channels; ++input) {
+                        mixer->setGain(input, mix, 0.1f);
+                        mixer->setPan(input, mix, (input % 9) / 4.0f - 1.0f);
+                    }
+                }
+                mixer->snapToTargets();
+                return std::unique_ptr<Syntri::AudioProcessor>(std::move(mixer));
+            } },
+        };
+
+        if (pool) {
+            cases.push_back({ "processor/matrix_mixer_parallel", [pool](int channels) {
+                auto mixer = std::make_unique<Syntri::MatrixMixer>(channels, channels / 2);
+                for (int mix = 0; mix < channels / 2; ++mix) {
+                    for (int input = 0; input < channels; ++input) {
+                        mixer->setGain(input, mix, 0.1f);
+                    }
+                }
+                mixer->snapToTargets();
+                mixer->setWorkerPool(pool);
+                return std::unique_ptr<Syntri::AudioProcessor>(std::move(mixer));
+            } });
+        }
+        return cases;
+    }
+
+    void benchProcessors(const BenchOptions& options, std::vector<BenchResult>& results) {
+        std::unique_ptr<Syntri::RealtimeWorkerPool> pool;
+        if (std::thread::hardware_concurrency() > 1) {
+            pool = std::make_unique<Syntri::RealtimeWorkerPool>();
+        }
+
+        for (const ProcessorCase& processor_case : processorCases(pool.get())) {
+            if (processor_case.name.find(options.filter) == std::string::npos) continue;
+
+            for (int channels : CHANNEL_COUNTS) {
+                for (int buffer_size : BUFFER_SIZES) {
+                    for (int sample_rate : SAMPLE_RATES) {
+                        Syntri::AudioBlockStorage inputs(channels, buffer_size);
+                        Syntri::AudioBlockStorage outputs(channels, buffer_size);
+                        Syntri::LegacyProcessorBridge bridge;
+                        fillNoise(inputs);
+                        bridge.prepare(channels, channels, buffer_size);
+
+                        auto processor = processor_case.create(channels);
+                        processor->setupChanged(sample_rate, buffer_size);
+
+                        const Syntri::ConstAudioBlock in = static_cast<const Syntri::AudioBlockStorage&>(inputs).getBlock();
+                        const Syntri::AudioBlock out = outputs.getBlock();
+                        double ns = measure([&]() { Syntri::invokeProcessor(*processor, bridge, in, out); },
+                            options.min_seconds);
+
+                        results.push_back(makeResult(processor_case.name, "processor", channels, buffer_size,
+                            sample_rate, ns, 8.0 * channels * buffer_size));
+                    }
+                }
+            }
+        }
+    }
+
+    // ====================================
+    // Reporting
+    // ====================================
+    void printTable(const std::vector<BenchResult>& results) {
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-36s %4s %5s %6s %12s %10s %8s %10s",
+            "case", "ch", "buf", "rate", "ns/block", "ns/sample", "GB/s", "headroom");
+        std::cout << line << std::endl;
+        for (const BenchResult& r : results) {
+            std::snprintf(line, sizeof(line), "%-36s %4d %5d %6d %12.1f %10.3f %8.2f %9.1fx",
+                r.name.c_str(), r.channels, r.buffer_size, r.sample_rate, r.ns_per_block,
+                r.ns_per_sample, r.gb_per_second, r.realtime_headroom);
+            std::cout << line << std::endl;
+        }
+    }
+
+    std::string toJson(const std::vector<BenchResult>& results) {
+        std::ostringstream json;
+        json.precision(6);
+        json << "{\n";
+        json << "  \"syntri_version\": \"" << SYNTRI_VERSION << "\",\n";
+        json << "  \"instruction_set\": \""
+            << Syntri::Kernels::instructionSetToString(Syntri::Kernels::getActiveInstructionSet()) << "\",\n";
+        json << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+        json << "  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r = results[i];
+            json << "    {\"name\": \"" << r.name << "\", \"kind\": \"" << r.kind << "\""
+                << ", \"channels\": " << r.channels << ", \"buffer_size\": " << r.buffer_size
+                << ", \"sample_rate\": " << r.sample_rate << ", \"ns_per_block\": " << r.ns_per_block
+                << ", \"ns_per_sample\": " << r.ns_per_sample << ", \"gb_per_second\": " << r.gb_per_second
+                << ", \"realtime_headroom\": " << r.realtime_headroom << "}"
+                << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        json << "  ]\n}\n";
+        return json.str();
+    }
+
+    void printUsage() {
+        std::cout << "Usage: syntri_bench [--json <file|->] [--filter <substring>] [--isa <scalar|sse2|avx2|avx512>]"
+            << " [--min-time <seconds>] [--quick]" << std::endl;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--json" && has_value) {
+            options.json_path = argv[++i];
+        }
+        else if (arg == "--filter" && has_value) {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--min-time" && has_value) {
+            options.min_seconds = std::max(std::atof(argv[++i]), 1.0e-4);
+        }
+        else if (arg == "--isa" && has_value) {
+            std::string name = argv[++i];
+            Syntri::Kernels::InstructionSet isa = Syntri::Kernels::InstructionSet::SCALAR;
+            if (name == "sse2") isa = Syntri::Kernels::InstructionSet::SSE2;
+            else if (name == "avx2") isa = Syntri::Kernels::InstructionSet::AVX2;
+            else if (name == "avx512") isa = Syntri::Kernels::InstructionSet::AVX512;
+            if (!Syntri::Kernels::setActiveInstructionSet(isa)) {
+                std::cerr << "Instruction set " << name << " is not supported here" << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--quick") {
+            options.min_seconds = 0.0005;
+        }
+        else {
+            printUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    // The audio thread runs with denormals flushed; benchmark the same way
+    Syntri::enableDenormalFlush();
+
+    // JSON on stdout replaces the table
+    const bool table = options.json_path != "-";
+    if (table) {
+        std::cout << "=====================================" << std::endl;
+        std::cout << "    SYNTRI - BENCHMARK SUITE" << std::endl;
+        std::cout << "=====================================" << std::endl;
+        std::cout << "Version: " << SYNTRI_VERSION << "   Kernels: "
+            << Syntri::Kernels::instructionSetToString(Syntri::Kernels::getActiveInstructionSet())
+            << "   Min time/case: " << options.min_seconds << " s" << std::endl;
+        std::cout << std::endl;
+    }
+
+    // The console log sink shares stdout; JSON there must stay parseable
+    if (!table) {
+        Syntri::setLogLevel(Syntri::LogLevel::OFF);
+    }
+
+    std::vector<BenchResult> results;
+    benchKernels(options, results);
+    benchProcessors(options, results);
+    // Anything still queued prints before the results, not inside them
+    Syntri::flushLog();
+
+    if (table) {
+        printTable(results);
+    }
+
+    if (!options.json_path.empty()) {
+        std::string json = toJson(results);
+        if (options.json_path == "-") {
+            std::cout << json;
+        }
+        else {
+            std::ofstream file(options.json_path);
+            file << json;
+            if (!file) {
+                std::cerr << "Cannot write " << options.json_path << std::endl;
+                return 1;
+            }
+            std::cout << std::endl << "JSON written to " << options.json_path << std::endl;
+        }
+    }
+
+    return results.empty() ? 1 : 0;
+}
@@ -0,0 +1,62 @@
+// include/syntri/adaptive_buffer.h
+// Buffer size controller - trades a little latency for no dropouts, driven by xruns and tail DSP load
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include <vector>
+
+namespace Syntri {
+
+    struct AdaptiveBufferOptions {
+        std::vector<int> buffer_sizes = { BUFFER_SIZE_ULTRA_LOW, BUFFER_SIZE_LOW, 128 };  // Smallest first
+        double step_up_load_percent = 80.0;     // p99.9 DSP load that counts as trouble
+        double step_down_load_percent = 40.0;   // p99.9 must stay below this to count as stable
+        double stable_seconds = 10.0;           // Of audio, clean and below step_down, before stepping down
+        std::uint64_t window_callbacks = 1000;  // Callbacks per judgement, so p99.9 means one in a thousand
+    };
+
+    enum class AdaptiveBufferAction {
+        HOLD,
+        STEP_UP,
+        STEP_DOWN
+    };
+
+    // Watches an interface's metrics from a control thread and walks the
+    // buffer size ladder with AudioInterface::reconfigure(). Any xrun, or a
+    // p99.9 DSP load above step_up_load_percent, in a window of
+    // window_callbacks callbacks steps up one size at once. Stepping down
+    // needs stable_seconds of audio at the current size with no xruns and
+    // every window's p99.9 below step_down_load_percent; the gap between the
+    // two thresholds keeps it from oscillating.
+    //
+    // Windows are snapshot differences, so the controller never touches the
+    // audio thread and time is counted in callbacks, so it drives a
+    // virtual-time stub the same way as a real stream. Only the virtual one
+    // is deterministic: it records simulated load alone.
+    class AdaptiveBufferController {
+    private:
+        AudioInterface& interface_;
+        AdaptiveBufferOptions options_;
+        int sample_rate_;
+        int level_;                     // Index into options_.buffer_sizes
+        MetricsSnapshot window_start_;
+        double stable_seconds_;
+
+        bool moveTo(int level);
+
+    public:
+        // `buffer_size` is what the interface runs at now; the ladder starts at
+        // the first size not smaller than it
+        AdaptiveBufferController(AudioInterface& interface, int sample_rate, int buffer_size,
+            const AdaptiveBufferOptions& options = AdaptiveBufferOptions());
+
+        // Call periodically from a control thread. Judges the callbacks since
+        // the last completed window and reconfigures if needed; returns HOLD
+        // while a window is still filling.
+        AdaptiveBufferAction update();
+
+        int getBufferSize() const { return options_.buffer_sizes[static_cast<size_t>(level_)]; }
+        double getStableSeconds() const { return stable_seconds_; }
+    };
+
+} // namespace Syntri
@@ -0,0 +1,108 @@
+// include/syntri/audio_block.h
+// Planar audio buffers - non-owning channel views over one aligned slab per stream
+#pragma once
+
+#include "syntri/types.h"
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace Syntri {
+
+    // Channel data starts on a cache-line boundary and each channel's stride is
+    // padded to a whole number of cache lines, so SIMD loads never split lines.
+    constexpr std::size_t AUDIO_BLOCK_ALIGNMENT = 64;
+
+    // Non-owning planar view: channel pointer table + frame count.
+    // Copying a view is cheap and never allocates - safe in the audio callback.
+    template <typename SampleType>
+    class BasicAudioBlock {
+    private:
+        SampleType* const* channels_ = nullptr;
+        int num_channels_ = 0;
+        int num_frames_ = 0;
+        int frame_offset_ = 0;
+
+    public:
+        BasicAudioBlock() = default;
+
+        BasicAudioBlock(SampleType* const* channels, int num_channels, int num_frames, int frame_offset = 0)
+            : channels_(channels), num_channels_(num_channels), num_frames_(num_frames),
+            frame_offset_(frame_offset) {
+        }
+
+        // A writable block can always be read as a const block
+        template <typename Other, typename = typename std::enable_if<
+            std::is_same<const Other, SampleType>::value && !std::is_same<Other, SampleType>::value>::type>
+        BasicAudioBlock(const BasicAudioBlock<Other>& other)
+            : channels_(other.getChannelTable()), num_channels_(other.getNumChannels()),
+            num_frames_(other.getNumFrames()), frame_offset_(other.getFrameOffset()) {
+        }
+
+        int getNumChannels() const { return num_channels_; }
+        int getNumFrames() const { return num_frames_; }
+        bool isEmpty() const { return num_channels_ == 0 || num_frames_ == 0; }
+
+        SampleType* getChannel(int channel) const {
+            return channels_[channel] + frame_offset_;
+        }
+
+        // Frames [frame_offset, frame_offset + num_frames) of the same channels
+        BasicAudioBlock getSubBlock(int frame_offset, int num_frames) const {
+            return BasicAudioBlock(channels_, num_channels_, num_frames, frame_offset_ + frame_offset);
+        }
+
+        // num_channels channels starting at first_channel
+        BasicAudioBlock getChannelRange(int first_channel, int num_channels) const {
+            return BasicAudioBlock(channels_ + first_channel, num_channels, num_frames_, frame_offset_);
+        }
+
+        // Raw table access for code that builds derived views
+        SampleType* const* getChannelTable() const { return channels_; }
+        int getFrameOffset() const { return frame_offset_; }
+    };
+
+    using AudioBlock = BasicAudioBlock<AudioSample>;
+    using ConstAudioBlock = BasicAudioBlock<const AudioSample>;
+
+    // Owns one cache-line-aligned slab holding every channel of a stream.
+    // allocate() is NOT real-time safe; everything else is.
+    class AudioBlockStorage {
+    private:
+        AudioSample* data_;
+        std::vector<AudioSample*> channel_pointers_;
+        int num_channels_;
+        int num_frames_;
+        int channel_stride_;
+
+        void release();
+
+    public:
+        AudioBlockStorage();
+        AudioBlockStorage(int num_channels, int num_frames);
+        ~AudioBlockStorage();
+
+        AudioBlockStorage(const AudioBlockStorage&) = delete;
+        AudioBlockStorage& operator=(const AudioBlockStorage&) = delete;
+        AudioBlockStorage(AudioBlockStorage&& other) noexcept;
+        AudioBlockStorage& operator=(AudioBlockStorage&& other) noexcept;
+
+        // (Re)allocate and zero the slab
+        void allocate(int num_channels, int num_frames);
+
+        // Zero all samples
+        void clear();
+
+        AudioBlock getBlock() { return AudioBlock(channel_pointers_.data(), num_channels_, num_frames_); }
+        ConstAudioBlock getBlock() const { return ConstAudioBlock(channel_pointers_.data(), num_channels_, num_frames_); }
+
+        int getNumChannels() const { return num_channels_; }
+        int getNumFrames() const { return num_frames_; }
+        int getChannelStride() const { return channel_stride_; }  // In samples
+    };
+
+    // Block helpers shared by processors and interfaces
+    void clearBlock(const AudioBlock& block);
+    void copyBlock(const ConstAudioBlock& source, const AudioBlock& destination);
+
+} // namespace Syntri
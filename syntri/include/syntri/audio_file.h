@@ -0,0 +1,32 @@
+// include/syntri/audio_file.h
+// Whole-file WAV and raw float I/O for offline rendering and golden-file tests
+#pragma once
+
+#include "syntri/audio_block.h"
+#include <string>
+#include <vector>
+
+namespace Syntri {
+
+    enum class AudioFileFormat {
+        WAV,            // Reads PCM 16/24/32-bit and 32-bit float; writes 32-bit float
+        RAW_FLOAT32     // Headerless interleaved little-endian float32
+    };
+
+    struct AudioFileInfo {
+        int sample_rate = 0;        // 0 for raw files
+        int num_channels = 0;
+        long long num_frames = 0;
+    };
+
+    // Read a whole file as interleaved float samples in [-1, 1].
+    // Raw files need the channel count up front. On failure returns false
+    // and describes the problem in `error`.
+    bool readAudioFile(const std::string& path, AudioFileFormat format, int raw_channels,
+        AudioFileInfo& info, std::vector<AudioSample>& interleaved, std::string& error);
+
+    // Write every channel of `block`; sample_rate is ignored for raw files
+    bool writeAudioFile(const std::string& path, AudioFileFormat format, const ConstAudioBlock& block,
+        int sample_rate, std::string& error);
+
+} // namespace Syntri
@@ -3,6 +3,12 @@
 #pragma once
 
 #include "syntri/types.h"
+#include "syntri/audio_block.h"
+#include "syntri/realtime_metrics.h"
+#include "syntri/rt_safety.h"
+#include "syntri/rt_thread.h"
+#include "syntri/trace.h"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
@@ -14,17 +20,74 @@ namespace Syntri {
     public:
         virtual ~AudioProcessor() = default;
 
-        // Main audio processing callback - must be real-time safe
+        // Main audio processing callback - must be real-time safe.
+        // Default implementation wraps the vectors as blocks and forwards
+        // to the planar overload.
         virtual void processAudio(
             const MultiChannelBuffer& inputs,
             MultiChannelBuffer& outputs,
             int num_samples
-        ) = 0;
+        );
+
+        // Planar callback - channels live in one aligned slab, nothing to resize.
+        // Processors that override this should return true from usesAudioBlocks()
+        // so interfaces call it directly. Default implementation outputs silence.
+        virtual void processAudio(const ConstAudioBlock& inputs, const AudioBlock& outputs);
+
+        virtual bool usesAudioBlocks() const { return false; }
 
         // Called when audio parameters change
         virtual void setupChanged(int sample_rate, int buffer_size) = 0;
     };
 
+    // Feeds planar blocks to a processor that only implements the
+    // MultiChannelBuffer callback. prepare() allocates; process() does not.
+    class LegacyProcessorBridge {
+    private:
+        MultiChannelBuffer inputs_;
+        MultiChannelBuffer outputs_;
+
+    public:
+        void prepare(int num_input_channels, int num_output_channels, int max_frames);
+        void process(AudioProcessor& processor, const ConstAudioBlock& inputs, const AudioBlock& outputs);
+    };
+
+    // When the callback running on this thread must have its output ready,
+    // as a readClockTicks() timestamp: the end of the period the interface is
+    // filling, however much of the callback has already run. 0 outside a
+    // callback and for interfaces with no wall-clock deadline (offline
+    // render, virtual time).
+    std::uint64_t getCallbackDeadlineTicks();
+
+    // Publishes a deadline to getCallbackDeadlineTicks() for its lifetime. Nests.
+    class CallbackDeadlineScope {
+    private:
+        std::uint64_t previous_;
+
+    public:
+        explicit CallbackDeadlineScope(std::uint64_t deadline_ticks);
+        ~CallbackDeadlineScope();
+
+        CallbackDeadlineScope(const CallbackDeadlineScope&) = delete;
+        CallbackDeadlineScope& operator=(const CallbackDeadlineScope&) = delete;
+    };
+
+    // Runs either callback flavour on planar buffers, marked as a real-time
+    // callback for the safety checker and as a "callback" span for tracing.
+    // deadline_ticks is published to getCallbackDeadlineTicks() (0 = none).
+    inline void invokeProcessor(AudioProcessor& processor, LegacyProcessorBridge& bridge,
+        const ConstAudioBlock& inputs, const AudioBlock& outputs, std::uint64_t deadline_ticks = 0) {
+        RealtimeCallbackScope callback_scope;
+        CallbackDeadlineScope deadline_scope(deadline_ticks);
+        TraceScope trace_scope("callback");
+        if (processor.usesAudioBlocks()) {
+            processor.processAudio(inputs, outputs);
+        }
+        else {
+            bridge.process(processor, inputs, outputs);
+        }
+    }
+
     // Hardware abstraction interface - clean and simple
     class AudioInterface {
     public:
@@ -47,8 +110,44 @@ namespace Syntri {
         virtual void stopStreaming() = 0;
         virtual bool isStreaming() const = 0;
 
+        // Switch sample rate and buffer size. Interfaces that can switch live
+        // keep streaming: new buffers are allocated on the calling thread,
+        // setupChanged() runs there while the callback is parked between two
+        // periods, and the output fades out and back in across the switch.
+        // The default reinitializes a stopped interface and refuses while streaming.
+        virtual bool reconfigure(int sample_rate, int buffer_size);
+
+        // Install `next` while streaming, at a buffer boundary, crossfading
+        // from the old processor's output over `crossfade_frames`. next gets
+        // setupChanged() on the calling thread first. Blocks until the audio
+        // thread has made its last call into the old processor, then returns
+        // it for the caller to destroy. Returns nullptr if the interface
+        // cannot swap (the default) or is not streaming.
+        virtual AudioProcessor* swapProcessor(AudioProcessor* next, int crossfade_frames = 0) {
+            (void)next;
+            (void)crossfade_frames;
+            return nullptr;
+        }
+
         // Performance monitoring
         virtual SimpleMetrics getMetrics() const = 0;
+
+        // Full histogram snapshot - safe to call from any thread while streaming.
+        // Interfaces without a measured audio thread return an empty snapshot.
+        virtual MetricsSnapshot getMetricsSnapshot() const { return MetricsSnapshot(); }
+
+        // Scheduling, pinning and memory setup for the audio thread. Takes effect
+        // on the next startStreaming(); interfaces that own no thread ignore it.
+        virtual void setRealtimeThreadOptions(const RealtimeThreadOptions& options) { (void)options; }
+
+        // What the audio thread actually got (configured = false until it has started)
+        virtual RealtimeThreadStatus getRealtimeThreadStatus() const { return RealtimeThreadStatus(); }
+
+        // Count cycles, instructions, cache and branch misses around every
+        // processAudio() call (Linux perf_event_open). Takes effect on the next
+        // startStreaming(); totals land in getMetricsSnapshot().hardware_counters
+        // and cover the current processor only - swapProcessor() restarts them.
+        virtual void setHardwareCountersEnabled(bool enabled) { (void)enabled; }
     };
 
     // Factory functions for creating hardware interfaces
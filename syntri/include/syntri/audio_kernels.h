@@ -0,0 +1,57 @@
+// include/syntri/audio_kernels.h
+// Vectorized sample kernels - SSE2 / AVX2 / AVX-512 chosen at runtime
+#pragma once
+
+#include "syntri/types.h"
+
+namespace Syntri {
+namespace Kernels {
+
+    // Instruction sets in increasing order of preference
+    enum class InstructionSet {
+        SCALAR,
+        SSE2,
+        AVX2,       // AVX2 + FMA
+        AVX512      // AVX-512F
+    };
+
+    std::string instructionSetToString(InstructionSet isa);
+
+    // Best instruction set this CPU (and build) supports
+    InstructionSet detectInstructionSet();
+
+    // Instruction set used by the kernels below
+    InstructionSet getActiveInstructionSet();
+
+    // Force a specific path (tests and benchmarks). Returns false and leaves
+    // the active path unchanged if the CPU or build does not support it.
+    // Not real-time safe to call while another thread is mid-kernel.
+    bool setActiveInstructionSet(InstructionSet isa);
+
+    // All kernels accept any alignment and any length >= 0.
+    // Ramped variants interpolate linearly: sample i uses
+    // start + (end - start) * i / num_samples, so the next block continues at end.
+
+    void copy(const AudioSample* source, AudioSample* destination, int num_samples);
+    void clear(AudioSample* destination, int num_samples);
+
+    // destination = source * gain
+    void copyWithGain(const AudioSample* source, AudioSample* destination, int num_samples, float gain);
+
+    // buffer *= gain (in place)
+    void applyGain(AudioSample* buffer, int num_samples, float gain);
+    void applyGainRamp(AudioSample* buffer, int num_samples, float start_gain, float end_gain);
+
+    // bus += source * gain
+    void mixAccumulate(const AudioSample* source, AudioSample* bus, int num_samples, float gain);
+    void mixAccumulateRamp(const AudioSample* source, AudioSample* bus, int num_samples,
+        float start_gain, float end_gain);
+
+    // left += source * left_gain, right += source * right_gain
+    void panAccumulate(const AudioSample* source, AudioSample* left, AudioSample* right, int num_samples,
+        float left_gain, float right_gain);
+    void panAccumulateRamp(const AudioSample* source, AudioSample* left, AudioSample* right, int num_samples,
+        float left_start, float left_end, float right_start, float right_end);
+
+} // namespace Kernels
+} // namespace Syntri
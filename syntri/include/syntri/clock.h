@@ -0,0 +1,67 @@
+// include/syntri/clock.h
+// Hot-path timestamps - calibrated invariant TSC, falling back to CLOCK_MONOTONIC_RAW
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define SYNTRI_CLOCK_HAS_TSC 1
+#endif
+
+namespace Syntri {
+
+    enum class ClockSource {
+        TSC,                // Invariant time-stamp counter, read with rdtsc
+        MONOTONIC_RAW,      // clock_gettime(CLOCK_MONOTONIC_RAW) - never slewed by NTP
+        STEADY_CLOCK        // std::chrono::steady_clock on platforms without either
+    };
+
+    const char* clockSourceName(ClockSource source);
+
+    struct ClockInfo {
+        ClockSource source = ClockSource::STEADY_CLOCK;
+        double ticks_per_second = 1.0e9;
+    };
+
+    namespace detail {
+        constexpr int CLOCK_MODE_UNCALIBRATED = 0;
+        constexpr int CLOCK_MODE_TSC = 1;
+        constexpr int CLOCK_MODE_FALLBACK = 2;
+
+        extern std::atomic<int> clock_mode;
+        std::uint64_t readClockTicksSlow();
+    }
+
+    // Pick the source and measure the TSC rate (~10 ms). Runs automatically
+    // before main(); calling it again is free.
+    const ClockInfo& calibrateClock();
+    inline const ClockInfo& getClockInfo() { return calibrateClock(); }
+
+    // Raw, monotonic timestamp in clock ticks. On the TSC path this is a single
+    // rdtsc with no vDSO call. Take differences on the audio thread and leave
+    // conversion to the code that reports them.
+    inline std::uint64_t readClockTicks() {
+#if defined(SYNTRI_CLOCK_HAS_TSC)
+        if (detail::clock_mode.load(std::memory_order_relaxed) == detail::CLOCK_MODE_TSC) {
+            return __rdtsc();
+        }
+#endif
+        return detail::readClockTicksSlow();
+    }
+
+    // Durations: a multiply and a shift, no division
+    std::uint64_t clockTicksToNanoseconds(std::uint64_t ticks);
+    std::uint64_t nanosecondsToClockTicks(std::uint64_t nanoseconds);
+
+    // Timestamps: nanoseconds on the CLOCK_MONOTONIC_RAW timeline (steady_clock
+    // where that does not exist), comparable across threads
+    std::uint64_t clockTimestampToNanoseconds(std::uint64_t ticks);
+    inline std::uint64_t clockNanoseconds() { return clockTimestampToNanoseconds(readClockTicks()); }
+
+} // namespace Syntri
@@ -0,0 +1,143 @@
+// include/syntri/command_queue.h
+// Bounded lock-free queues for posting commands from control threads to the audio thread
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace Syntri {
+
+    // Producer and consumer indices live on separate cache lines
+    constexpr std::size_t COMMAND_QUEUE_ALIGNMENT = 64;
+
+    namespace detail {
+        inline std::size_t roundUpToPowerOfTwo(std::size_t value) {
+            std::size_t result = 2;
+            while (result < value) result <<= 1;
+            return result;
+        }
+    }
+
+    // Single producer, single consumer. Both push() and pop() are wait-free.
+    template <typename T>
+    class SpscQueue {
+        static_assert(std::is_trivially_copyable<T>::value, "Queued commands must be trivially copyable");
+
+    private:
+        std::unique_ptr<T[]> items_;
+        std::size_t mask_;
+        alignas(COMMAND_QUEUE_ALIGNMENT) std::atomic<std::size_t> head_;    // Next slot to read
+        alignas(COMMAND_QUEUE_ALIGNMENT) std::atomic<std::size_t> tail_;    // Next slot to write
+
+    public:
+        // Capacity is rounded up to a power of two. Allocates - construct off the audio thread.
+        explicit SpscQueue(std::size_t capacity)
+            : items_(new T[detail::roundUpToPowerOfTwo(capacity)]),
+            mask_(detail::roundUpToPowerOfTwo(capacity) - 1), head_(0), tail_(0) {
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        std::size_t capacity() const { return mask_ + 1; }
+
+        // Producer thread only; false when full
+        bool push(const T& item) {
+            const std::size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_.load(std::memory_order_acquire) > mask_) {
+                return false;
+            }
+            items_[tail & mask_] = item;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer thread only; false when empty
+        bool pop(T& item) {
+            const std::size_t head = head_.load(std::memory_order_relaxed);
+            if (head == tail_.load(std::memory_order_acquire)) {
+                return false;
+            }
+            item = items_[head & mask_];
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+    };
+
+    // Any number of producers, one consumer (the audio thread).
+    //
+    // Each slot carries a sequence number, so producers only contend on a
+    // single CAS to claim a slot (lock-free) and the consumer never waits on
+    // anyone (wait-free). A producer preempted between claiming and
+    // publishing its slot only delays items behind it - pop() then reports
+    // empty rather than blocking.
+    template <typename T>
+    class MpscQueue {
+        static_assert(std::is_trivially_copyable<T>::value, "Queued commands must be trivially copyable");
+
+    private:
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            T item;
+        };
+
+        std::unique_ptr<Cell[]> cells_;
+        std::size_t mask_;
+        alignas(COMMAND_QUEUE_ALIGNMENT) std::atomic<std::size_t> tail_;    // Next slot to claim
+        alignas(COMMAND_QUEUE_ALIGNMENT) std::size_t head_;                 // Consumer-owned
+
+    public:
+        // Capacity is rounded up to a power of two. Allocates - construct off the audio thread.
+        explicit MpscQueue(std::size_t capacity)
+            : cells_(new Cell[detail::roundUpToPowerOfTwo(capacity)]),
+            mask_(detail::roundUpToPowerOfTwo(capacity) - 1), tail_(0), head_(0) {
+            for (std::size_t i = 0; i <= mask_; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        std::size_t capacity() const { return mask_ + 1; }
+
+        // Any thread; false when full
+        bool push(const T& item) {
+            std::size_t position = tail_.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = cells_[position & mask_];
+                const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(sequence - position);
+
+                if (lag == 0) {
+                    if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        cell.item = item;
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0) {
+                    return false;   // Consumer has not freed this slot yet
+                }
+                else {
+                    position = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Consumer thread only; false when empty
+        bool pop(T& item) {
+            Cell& cell = cells_[head_ & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != head_ + 1) {
+                return false;
+            }
+            item = cell.item;
+            cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+            ++head_;
+            return true;
+        }
+    };
+
+} // namespace Syntri
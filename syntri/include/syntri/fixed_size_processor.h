@@ -0,0 +1,68 @@
+// include/syntri/fixed_size_processor.h
+// Processors specialized at compile time for the deployed channel counts and block sizes
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include <utility>
+
+namespace Syntri {
+
+    // The shapes we ship: 8, 16 or 64 channels at 32 or 64 samples. The
+    // dispatch below instantiates exactly these, so this is the only list.
+    using FixedChannelCounts = std::integer_sequence<int, 8, 16, 64>;
+    using FixedFrameCounts = std::integer_sequence<int, BUFFER_SIZE_ULTRA_LOW, BUFFER_SIZE_LOW>;
+
+    namespace detail {
+        template <int... Values>
+        constexpr bool containsValue(std::integer_sequence<int, Values...>, int value) {
+            return ((value == Values) || ...);
+        }
+    }
+
+    constexpr bool isFixedShape(int channels, int frames) {
+        return detail::containsValue(FixedChannelCounts(), channels) && detail::containsValue(FixedFrameCounts(), frames);
+    }
+
+    // Base for processors with a compile-time specialized inner loop.
+    // Derived (CRTP) provides
+    //     template <int Channels, int Frames>
+    //     void processFixed(const ConstAudioBlock& inputs, const AudioBlock& outputs);
+    //     void processDynamic(const ConstAudioBlock& inputs, const AudioBlock& outputs);
+    //
+    // processAudio() picks the processFixed instantiation when the block is
+    // one of the fixed shapes - same channel count in and out - so its loops
+    // have constant trip counts, unroll and vectorize without a scalar tail.
+    // Anything else goes to processDynamic. Both must produce the same audio.
+    template <typename Derived>
+    class FixedSizeProcessor : public AudioProcessor {
+    private:
+        template <int Channels, int... Frames>
+        bool dispatchFrames(const ConstAudioBlock& inputs, const AudioBlock& outputs,
+            std::integer_sequence<int, Frames...>) {
+            Derived& self = static_cast<Derived&>(*this);
+            return ((outputs.getNumFrames() == Frames &&
+                (self.template processFixed<Channels, Frames>(inputs, outputs), true)) || ...);
+        }
+
+        template <int... Channels>
+        bool dispatchChannels(const ConstAudioBlock& inputs, const AudioBlock& outputs,
+            std::integer_sequence<int, Channels...>) {
+            return ((outputs.getNumChannels() == Channels &&
+                dispatchFrames<Channels>(inputs, outputs, FixedFrameCounts())) || ...);
+        }
+
+    public:
+        using AudioProcessor::processAudio;
+
+        void processAudio(const ConstAudioBlock& inputs, const AudioBlock& outputs) override {
+            const bool same_shape = inputs.getNumChannels() == outputs.getNumChannels() &&
+                inputs.getNumFrames() == outputs.getNumFrames();
+            if (!same_shape || !dispatchChannels(inputs, outputs, FixedChannelCounts())) {
+                static_cast<Derived&>(*this).processDynamic(inputs, outputs);
+            }
+        }
+
+        bool usesAudioBlocks() const override { return true; }
+    };
+
+} // namespace Syntri
@@ -0,0 +1,263 @@
+// include/syntri/fused_stages.h
+// Fused per-channel stages - trim, polarity, gain, balance and metering in one pass per channel
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include "syntri/audio_kernels.h"
+#include "syntri/fixed_size_processor.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+namespace Syntri {
+
+    // A stage is any type with
+    //     Kernel beginChannel(int channel) const;           // This channel's parameters, by value
+    //     void endChannel(int channel, const Kernel&);      // Publish per-channel results
+    // where Kernel has float process(float sample). Kernels live on the
+    // stack for the length of one channel, so their state stays in registers
+    // instead of being reloaded after every store to the output.
+    // Parameters are plain values: change them between blocks, on the thread
+    // that runs the chain. Meter results are atomics and readable anywhere.
+
+    // Kernel for any stage that is a per-channel multiply
+    struct GainKernel {
+        float gain;
+        float process(float sample) const { return sample * gain; }
+    };
+
+    namespace detail {
+        class ChannelGainStage {
+        private:
+            std::array<float, MAX_AUDIO_CHANNELS> gains_;
+
+        public:
+            ChannelGainStage() { gains_.fill(1.0f); }
+
+            void setGain(int channel, float gain) {
+                if (channel >= 0 && channel < MAX_AUDIO_CHANNELS) gains_[static_cast<size_t>(channel)] = gain;
+            }
+            void setGainDb(int channel, float db) { setGain(channel, std::pow(10.0f, db / 20.0f)); }
+            float getGain(int channel) const { return gains_[static_cast<size_t>(channel)]; }
+
+            GainKernel beginChannel(int channel) const { return { gains_[static_cast<size_t>(channel)] }; }
+            void endChannel(int, const GainKernel&) {}
+        };
+    }
+
+    // Input trim, before everything else
+    class TrimStage : public detail::ChannelGainStage {};
+
+    // Channel fader
+    class GainStage : public detail::ChannelGainStage {};
+
+    class PolarityStage {
+    private:
+        std::array<float, MAX_AUDIO_CHANNELS> signs_;
+
+    public:
+        PolarityStage() { signs_.fill(1.0f); }
+
+        void setInverted(int channel, bool inverted) {
+            if (channel >= 0 && channel < MAX_AUDIO_CHANNELS) signs_[static_cast<size_t>(channel)] = inverted ? -1.0f : 1.0f;
+        }
+        bool isInverted(int channel) const { return signs_[static_cast<size_t>(channel)] < 0.0f; }
+
+        GainKernel beginChannel(int channel) const { return { signs_[static_cast<size_t>(channel)] }; }
+        void endChannel(int, const GainKernel&) {}
+    };
+
+    // Balance over stereo pairs: channel 2p is left, 2p + 1 right. The near
+    // side stays at unity and the far side follows a cosine taper, so centre
+    // is unity on both sides and hard left/right silences the other side.
+    // This is the chain's pan control: a true pan turns one channel into
+    // two, which is not elementwise - that belongs to MatrixMixer.
+    class BalanceStage {
+    private:
+        std::array<float, MAX_AUDIO_CHANNELS> gains_;
+
+    public:
+        BalanceStage() { gains_.fill(1.0f); }
+
+        // position -1 (left) .. +1 (right)
+        void setBalance(int pair, float position) {
+            const int left = 2 * pair;
+            if (pair < 0 || left + 1 >= MAX_AUDIO_CHANNELS) return;
+            const float clamped = std::min(1.0f, std::max(-1.0f, position));
+            const float far_gain = std::cos(std::fabs(clamped) * 0.5f * 3.14159265f);
+            gains_[static_cast<size_t>(left)] = clamped > 0.0f ? far_gain : 1.0f;
+            gains_[static_cast<size_t>(left + 1)] = clamped < 0.0f ? far_gain : 1.0f;
+        }
+        float getGain(int channel) const { return gains_[static_cast<size_t>(channel)]; }
+
+        GainKernel beginChannel(int channel) const { return { gains_[static_cast<size_t>(channel)] }; }
+        void endChannel(int, const GainKernel&) {}
+    };
+
+    // Sample peak since the last reset, per channel. Pass-through.
+    class PeakMeterStage {
+    public:
+        // Tracks the peak as the bits of |sample|: non-negative floats order
+        // the same as their bit patterns, and an integer max reduction
+        // vectorizes where a float one (NaN and signed-zero rules) does not.
+        struct Kernel {
+            int32_t peak_bits;
+            float process(float sample) {
+                int32_t bits;
+                std::memcpy(&bits, &sample, sizeof(bits));
+                bits &= 0x7fffffff;
+                peak_bits = bits > peak_bits ? bits : peak_bits;
+                return sample;
+            }
+            float getPeak() const {
+                float peak;
+                std::memcpy(&peak, &peak_bits, sizeof(peak));
+                return peak;
+            }
+        };
+
+        PeakMeterStage() { resetPeaks(); }
+
+        float getPeak(int channel) const { return peaks_[static_cast<size_t>(channel)].load(std::memory_order_relaxed); }
+        void resetPeaks() {
+            for (auto& peak : peaks_) peak.store(0.0f, std::memory_order_relaxed);
+        }
+
+        Kernel beginChannel(int) const { return { 0 }; }
+        void endChannel(int channel, const Kernel& kernel) {
+            std::atomic<float>& peak = peaks_[static_cast<size_t>(channel)];
+            const float block_peak = kernel.getPeak();
+            if (block_peak > peak.load(std::memory_order_relaxed)) peak.store(block_peak, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<float>, MAX_AUDIO_CHANNELS> peaks_;
+    };
+
+    // Runs its stages as one loop per channel: each sample is loaded once,
+    // passes through every stage in registers and is stored once, instead of
+    // one read-modify-write pass over the block per stage. The stage calls
+    // are inlined, so a chain of gains compiles to the same vector loop as a
+    // single gain. processUnfused() keeps the pass-per-stage form as the
+    // reference for tests and benchmarks.
+    template <typename... Stages>
+    class StageChain {
+    private:
+        std::tuple<Stages...> stages_;
+
+        // FrameCount is int, or std::integral_constant for a fixed block size
+        template <typename FrameCount, size_t... I>
+        void runChannel(const AudioSample* input, AudioSample* output, FrameCount num_frames, int channel,
+            std::index_sequence<I...>) {
+            auto kernels = std::make_tuple(std::get<I>(stages_).beginChannel(channel)...);
+            for (int i = 0; i < num_frames; ++i) {
+                float sample = input[i];
+                ((sample = std::get<I>(kernels).process(sample)), ...);
+                output[i] = sample;
+            }
+            (std::get<I>(stages_).endChannel(channel, std::get<I>(kernels)), ...);
+        }
+
+        template <typename Stage>
+        static void runStage(Stage& stage, const AudioSample* input, AudioSample* output, int num_frames, int channel) {
+            auto kernel = stage.beginChannel(channel);
+            for (int i = 0; i < num_frames; ++i) output[i] = kernel.process(input[i]);
+            stage.endChannel(channel, kernel);
+        }
+
+    public:
+        static constexpr size_t STAGE_COUNT = sizeof...(Stages);
+
+        template <size_t I>
+        auto& stage() { return std::get<I>(stages_); }
+        template <typename Stage>
+        Stage& stage() { return std::get<Stage>(stages_); }
+
+        // Channels beyond MAX_AUDIO_CHANNELS are copied untouched. In place is fine.
+        void process(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+            const int frames = outputs.getNumFrames();
+            for (int ch = 0; ch < outputs.getNumChannels(); ++ch) {
+                const AudioSample* input = ch < inputs.getNumChannels() ? inputs.getChannel(ch) : nullptr;
+                if (!input) {
+                    Kernels::clear(outputs.getChannel(ch), frames);
+                }
+                else if (ch < MAX_AUDIO_CHANNELS) {
+                    runChannel(input, outputs.getChannel(ch), frames, ch, std::index_sequence_for<Stages...>());
+                }
+                else if (input != outputs.getChannel(ch)) {
+                    Kernels::copy(input, outputs.getChannel(ch), frames);
+                }
+            }
+        }
+
+        void process(const AudioBlock& block) { process(ConstAudioBlock(block), block); }
+
+        // Same as process() for exactly Channels channels of Frames frames
+        template <int Channels, int Frames>
+        void processFixed(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+            static_assert(Channels <= MAX_AUDIO_CHANNELS, "stage parameters cover MAX_AUDIO_CHANNELS");
+            for (int ch = 0; ch < Channels; ++ch) {
+                runChannel(inputs.getChannel(ch), outputs.getChannel(ch), std::integral_constant<int, Frames>(), ch,
+                    std::index_sequence_for<Stages...>());
+            }
+        }
+
+        void process(MultiChannelBuffer& buffer, int num_samples) {
+            const int channels = std::min(static_cast<int>(buffer.size()), MAX_AUDIO_CHANNELS);
+            for (int ch = 0; ch < channels; ++ch) {
+                AudioBuffer& samples = buffer[static_cast<size_t>(ch)];
+                const int frames = std::min(num_samples, static_cast<int>(samples.size()));
+                runChannel(samples.data(), samples.data(), frames, ch, std::index_sequence_for<Stages...>());
+            }
+        }
+
+        // One full pass over the block per stage
+        void processUnfused(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+            const int frames = outputs.getNumFrames();
+            const int channels = std::min(outputs.getNumChannels(), MAX_AUDIO_CHANNELS);
+            for (int ch = 0; ch < channels; ++ch) {
+                if (ch < inputs.getNumChannels()) {
+                    Kernels::copy(inputs.getChannel(ch), outputs.getChannel(ch), frames);
+                }
+                else {
+                    Kernels::clear(outputs.getChannel(ch), frames);
+                }
+            }
+            std::apply([&](auto&... stage) {
+                (..., [&](auto& current) {
+                    for (int ch = 0; ch < channels; ++ch) {
+                        runStage(current, outputs.getChannel(ch), outputs.getChannel(ch), frames, ch);
+                    }
+                }(stage));
+            }, stages_);
+        }
+    };
+
+    // A stage chain as a block-callback processor, specialized for the fixed shapes
+    template <typename... Stages>
+    class FusedStageProcessor : public FixedSizeProcessor<FusedStageProcessor<Stages...>> {
+    private:
+        StageChain<Stages...> chain_;
+
+    public:
+        StageChain<Stages...>& getChain() { return chain_; }
+
+        template <int Channels, int Frames>
+        void processFixed(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+            chain_.template processFixed<Channels, Frames>(inputs, outputs);
+        }
+        void processDynamic(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+            chain_.process(inputs, outputs);
+        }
+        void setupChanged(int, int) override {}
+    };
+
+    // The usual input strip: trim, polarity, fader, balance, meter
+    using ChannelStripChain = StageChain<TrimStage, PolarityStage, GainStage, BalanceStage, PeakMeterStage>;
+
+} // namespace Syntri
@@ -0,0 +1,95 @@
+// include/syntri/log.h
+// Asynchronous logger - per-thread lock-free rings drained by a background thread
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace Syntri {
+
+    // Not DEBUG/ERROR: both are commonly defined as macros (our own Debug
+    // builds define DEBUG, <windows.h> defines ERROR)
+    enum class LogLevel {
+        VERBOSE = 0,    // Debug detail - compiled out of release builds
+        INFO = 1,
+        WARNING = 2,
+        SEVERE = 3,
+        OFF = 4
+    };
+
+    constexpr int LOG_MAX_THREADS = 32;             // Threads that can hold a ring at once
+    constexpr int LOG_QUEUE_CAPACITY = 128;         // Records per thread ring
+    constexpr int LOG_MESSAGE_CAPACITY = 232;       // Bytes per message, longer ones are truncated
+    constexpr int LOG_DRAIN_INTERVAL_MS = 2;        // Background drain period
+
+    struct LogRecord {
+        LogLevel level;
+        std::uint32_t thread_index;     // Ring that carried the record
+        std::uint64_t timestamp_ns;     // clockTimestampToNanoseconds(), for ordering across threads
+        char text[LOG_MESSAGE_CAPACITY];
+    };
+
+    // Receives every record on the drain thread (or the flushLog() caller)
+    using LogSink = std::function<void(const LogRecord&)>;
+
+    // Records below this level are discarded at the call site. Default INFO.
+    void setLogLevel(LogLevel level);
+    LogLevel getLogLevel();
+    bool logEnabled(LogLevel level);
+
+    // printf-style. Formats into the calling thread's ring and returns - never
+    // blocks, locks or allocates once the thread is registered. A full ring
+    // drops the message and counts it.
+#if defined(__GNUC__)
+    void logMessage(LogLevel level, const char* format, ...) __attribute__((format(printf, 2, 3)));
+#else
+    void logMessage(LogLevel level, const char* format, ...);
+#endif
+
+    // Claim a ring for the calling thread now. A thread's first message does
+    // this implicitly, which registers a thread-exit hook (allocates) - real-time
+    // threads call this before their first callback.
+    bool registerLogThread();
+
+    // Replace the console sink (nullptr restores it). Not real-time safe.
+    void setLogSink(LogSink sink);
+
+    // Drain every ring into the sink on the calling thread and flush the console
+    void flushLog();
+
+    long long getDroppedLogMessages();
+
+} // namespace Syntri
+
+// Compile-time floor: calls below it are removed entirely, arguments unevaluated.
+// Defaults to INFO when NDEBUG is defined (release builds), VERBOSE otherwise.
+#ifndef SYNTRI_LOG_COMPILE_LEVEL
+#if defined(NDEBUG)
+#define SYNTRI_LOG_COMPILE_LEVEL 1
+#else
+#define SYNTRI_LOG_COMPILE_LEVEL 0
+#endif
+#endif
+
+#define SYNTRI_LOG(level, ...) \
+    do { if (::Syntri::logEnabled(level)) ::Syntri::logMessage(level, __VA_ARGS__); } while (0)
+
+#if SYNTRI_LOG_COMPILE_LEVEL <= 0
+#define SYNTRI_LOG_VERBOSE(...) SYNTRI_LOG(::Syntri::LogLevel::VERBOSE, __VA_ARGS__)
+#else
+#define SYNTRI_LOG_VERBOSE(...) ((void)0)
+#endif
+
+#if SYNTRI_LOG_COMPILE_LEVEL <= 1
+#define SYNTRI_LOG_INFO(...) SYNTRI_LOG(::Syntri::LogLevel::INFO, __VA_ARGS__)
+#else
+#define SYNTRI_LOG_INFO(...) ((void)0)
+#endif
+
+#if SYNTRI_LOG_COMPILE_LEVEL <= 2
+#define SYNTRI_LOG_WARNING(...) SYNTRI_LOG(::Syntri::LogLevel::WARNING, __VA_ARGS__)
+#else
+#define SYNTRI_LOG_WARNING(...) ((void)0)
+#endif
+
+#define SYNTRI_LOG_SEVERE(...) SYNTRI_LOG(::Syntri::LogLevel::SEVERE, __VA_ARGS__)
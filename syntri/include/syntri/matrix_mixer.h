@@ -0,0 +1,186 @@
+// include/syntri/matrix_mixer.h
+// N inputs x M stereo personal mixes - the core IEM mixing engine
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include "syntri/command_queue.h"
+#include "syntri/worker_pool.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Syntri {
+
+    constexpr int MAX_PERSONAL_MIXES = 64;
+
+    // Frames per cache tile: all inputs of one tile stay L1/L2 resident while
+    // every mix reads them (64 inputs x 64 frames x 4 bytes = 16 KB)
+    constexpr int MIXER_TILE_FRAMES = 64;
+
+    // Gain changes approach their target with this time constant by default
+    constexpr double MIXER_DEFAULT_SMOOTHING_MS = 10.0;
+
+    // Posted commands waiting for the audio thread, and how many it applies
+    // per block (the rest carry over so one burst cannot blow a deadline)
+    constexpr int MIXER_COMMAND_QUEUE_SIZE = 1024;
+    constexpr int MIXER_MAX_COMMANDS_PER_BLOCK = 128;
+
+    enum class MixerCommandType {
+        SET_GAIN,       // value = linear gain of input in mix (0 = not routed)
+        SET_PAN,        // value = -1 .. +1
+        SET_MUTE,       // value != 0 mutes input in mix, keeping its gain
+        SET_MIX_LEVEL   // value = mix master gain, input ignored
+    };
+
+    // Parameter change applied at `sample_offset` frames into the next block
+    // the mixer renders (0 = at its start; offsets past the end apply on its
+    // last frame). Gains still glide from that point, so changes never click.
+    struct MixerCommand {
+        MixerCommandType type = MixerCommandType::SET_GAIN;
+        int input = 0;
+        int mix = 0;
+        float value = 0.0f;
+        int sample_offset = 0;
+    };
+
+    // Renders `num_mixes` stereo mixes from `num_inputs` mono inputs.
+    // Mix m is written to output channels 2m (left) and 2m + 1 (right); mixes
+    // that do not fit in the output block are skipped.
+    //
+    // Setters may be called from any thread while streaming; each cell is an
+    // independent atomic target that the audio thread glides towards once per
+    // block, ramping linearly inside the block so steps never zipper.
+    // postCommand() does the same through a lock-free queue when a change has
+    // to land on a specific sample of the next block; the block is split into
+    // segments at the command offsets.
+    //
+    // With a worker pool attached, each mix is an independent task and the
+    // mixes of one block are rendered in parallel. The pool is entered once
+    // per block however many commands arrive: each task walks the segments
+    // of its own mix. Batches that finish after
+    // the interface's callback deadline (getCallbackDeadlineTicks()) show up
+    // in the pool's getDeadlineMisses(); they are never abandoned.
+    class MatrixMixer : public AudioProcessor {
+    private:
+        // Frames between two command offsets, with the commands applied at its start
+        struct Segment {
+            int start = 0;
+            int frames = 0;
+            float coefficient = 1.0f;   // Smoothing step for this many frames
+            int first_command = 0;
+            int end_command = 0;
+        };
+
+        int num_inputs_;
+        int num_mixes_;
+        int sample_rate_;
+        RealtimeWorkerPool* worker_pool_;
+        std::atomic<double> smoothing_ms_;
+
+        // Control-side targets, [mix * num_inputs + input]
+        std::unique_ptr<std::atomic<float>[]> target_gain_;
+        std::unique_ptr<std::atomic<float>[]> target_pan_;
+        std::unique_ptr<std::atomic<float>[]> mix_master_gain_;
+        std::unique_ptr<std::atomic<bool>[]> target_mute_;
+
+        // Sample-accurate commands, drained and ordered once per block
+        MpscQueue<MixerCommand> command_queue_;
+        std::vector<MixerCommand> pending_commands_;
+
+        // This block's split, planned once; read by every mix task
+        std::vector<Segment> segments_;
+        int num_segments_;
+        bool block_moving_;         // Gains may change this block - advance smoothing
+
+        // Bumped by every setter so the audio thread can skip unchanged blocks
+        std::atomic<unsigned> target_version_;
+
+        // Audio-side per-cell gains at the start / end of the current block
+        std::vector<float> current_left_;
+        std::vector<float> current_right_;
+        std::vector<float> next_left_;
+        std::vector<float> next_right_;
+
+        // Audio-side pan law cache, recomputed only when a cell's pan moves
+        std::vector<float> seen_pan_;
+        std::vector<float> pan_left_;
+        std::vector<float> pan_right_;
+
+        unsigned seen_version_;
+        bool settled_;              // Every cell has reached its target
+        std::unique_ptr<bool[]> mix_settled_;   // Per mix, written by that mix's task
+        int smoothing_frames_;      // Block size and time constant the
+        double smoothing_ms_used_;  // coefficient was computed for
+        float smoothing_coefficient_;
+
+        int cellIndex(int input, int mix) const { return mix * num_inputs_ + input; }
+        void updatePanLaw(int cell, float pan);
+        float smoothingCoefficient(int num_frames);
+
+        // Computes next_* from current_* and the targets for one mix's cells;
+        // returns true when all of them have reached their targets
+        bool advanceMixSmoothing(int mix, float coefficient);
+        void commitMix(int mix);
+
+        void applyCommand(const MixerCommand& command);
+        int drainCommands(int num_frames);
+        void planSegments(int num_frames);
+
+        // A mix's own commands and smoothing at either end of a segment.
+        // Touches only that mix's cells, so mixes can run on different threads.
+        void beginSegment(int mix, const Segment& segment);
+        void endSegment(int mix);
+
+        // Every segment of one mix; render = false only applies commands and glides
+        void processMix(int mix, const ConstAudioBlock& inputs, const AudioBlock& outputs, bool render);
+        static void processMixTask(void* context, int mix);
+
+    public:
+        MatrixMixer(int num_inputs, int num_mixes);
+
+        int getNumInputs() const { return num_inputs_; }
+        int getNumMixes() const { return num_mixes_; }
+
+        // Linear gain of one input in one mix (0 = not routed)
+        void setGain(int input, int mix, float gain);
+        float getGain(int input, int mix) const;
+
+        // Constant-power pan, -1 (left) .. +1 (right)
+        void setPan(int input, int mix, float pan);
+        float getPan(int input, int mix) const;
+
+        // Silence an input in one mix without losing its gain
+        void setMute(int input, int mix, bool muted);
+        bool isMuted(int input, int mix) const;
+
+        // Overall level of a personal mix
+        void setMixLevel(int mix, float gain);
+
+        // Queue a sample-accurate change from any thread. Never blocks;
+        // returns false if the queue is full.
+        bool postCommand(const MixerCommand& command);
+
+        // Jump straight to the targets (e.g. before streaming starts)
+        void snapToTargets();
+
+        // Render mixes in parallel on `pool` (nullptr = calling thread only).
+        // Set before streaming; the pool must outlive the mixer's use of it.
+        void setWorkerPool(RealtimeWorkerPool* pool) { worker_pool_ = pool; }
+
+        void setSmoothingTime(double milliseconds);
+
+        // Render one mix for frames [frame_start, frame_start + num_frames).
+        // Gains ramp along the block-wide ramp from current to next, so any
+        // tiling of the block yields identical output.
+        void renderMix(int mix, const ConstAudioBlock& inputs, const AudioBlock& outputs,
+            int frame_start, int num_frames, int block_frames) const;
+
+        // AudioProcessor
+        using AudioProcessor::processAudio;
+        void processAudio(const ConstAudioBlock& inputs, const AudioBlock& outputs) override;
+        bool usesAudioBlocks() const override { return true; }
+        void setupChanged(int sample_rate, int buffer_size) override;
+    };
+
+} // namespace Syntri
@@ -0,0 +1,123 @@
+// include/syntri/offline_interface.h
+// File-to-file AudioInterface - renders faster than real time for benchmarks and golden files
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include "syntri/audio_file.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Syntri {
+
+    struct OfflineRenderOptions {
+        std::string input_path;                             // Empty = silent input
+        AudioFileFormat input_format = AudioFileFormat::WAV;
+        int raw_input_channels = 2;                         // Channel count of raw input files
+
+        std::string output_path;                            // Empty = keep output in memory only
+        AudioFileFormat output_format = AudioFileFormat::WAV;
+
+        int num_input_channels = 8;                         // Silent input only
+        int num_output_channels = -1;                       // -1 = same as input
+        long long length_frames = 0;                        // Silent input length
+    };
+
+    struct OfflineRenderStats {
+        long long frames_rendered = 0;
+        long long blocks_rendered = 0;
+        double audio_seconds = 0.0;
+        double render_seconds = 0.0;    // Wall time inside the block loop only (no file I/O)
+        double realtime_multiple = 0.0; // audio_seconds / render_seconds
+    };
+
+    // Reads the whole input into memory, then calls processAudio back to back
+    // on fixed-size blocks with no sleeping, then writes the output file.
+    // File I/O is kept outside the timed loop, so the stats and metrics show
+    // only the processor's cost. A short final block is zero-padded, so the
+    // processor always sees buffer_size frames.
+    //
+    // startStreaming() renders on a background thread and isStreaming() turns
+    // false once the input is consumed, after which the next render can start
+    // straight away; render() does the same synchronously.
+    // The render never sleeps, so its thread only flushes denormals by default:
+    // a SCHED_FIFO thread that never blocks would starve the rest of the machine.
+    class OfflineAudioInterface : public AudioInterface {
+    private:
+        OfflineRenderOptions options_;
+        bool initialized_;
+        int sample_rate_;
+        int buffer_size_;
+        AudioProcessor* processor_;
+
+        std::atomic<bool> streaming_;
+        std::atomic<bool> stop_requested_;
+        std::thread render_thread_;
+
+        // Whole-file planar buffers; the processor sees sub-block views
+        AudioBlockStorage input_storage_;
+        AudioBlockStorage output_storage_;
+        LegacyProcessorBridge legacy_bridge_;
+        long long total_frames_;
+
+        RealtimeMetrics metrics_;
+        OfflineRenderStats stats_;
+        bool output_ok_;
+
+        RealtimeThreadOptions thread_options_;
+        RealtimeThreadStatus thread_status_;
+        mutable std::mutex thread_status_mutex_;
+        bool hardware_counters_enabled_;
+
+        bool prepare(AudioProcessor* processor);
+        void renderBlocks();
+        void finish();
+
+    public:
+        explicit OfflineAudioInterface(const OfflineRenderOptions& options);
+        ~OfflineAudioInterface() override;
+
+        bool initialize(int sample_rate = SAMPLE_RATE_96K, int buffer_size = BUFFER_SIZE_ULTRA_LOW) override;
+        void shutdown() override;
+        bool isInitialized() const override { return initialized_; }
+
+        HardwareType getType() const override { return HardwareType::OFFLINE_RENDER; }
+        std::string getName() const override { return "Syntri Offline Renderer"; }
+        int getInputChannelCount() const override;
+        int getOutputChannelCount() const override;
+        double getCurrentLatency() const override;
+
+        bool startStreaming(AudioProcessor* processor) override;
+        void stopStreaming() override;
+        bool isStreaming() const override { return streaming_.load(std::memory_order_acquire); }
+
+        SimpleMetrics getMetrics() const override;
+        MetricsSnapshot getMetricsSnapshot() const override { return metrics_.snapshot(); }
+
+        // Applies to the startStreaming() thread; render() only flushes denormals
+        // for its own duration and never changes the caller's scheduling
+        void setRealtimeThreadOptions(const RealtimeThreadOptions& options) override { thread_options_ = options; }
+        RealtimeThreadStatus getRealtimeThreadStatus() const override;
+
+        // Counters are opened on whichever thread renders, render() included
+        void setHardwareCountersEnabled(bool enabled) override { hardware_counters_enabled_ = enabled; }
+
+        // Load, render and write in the calling thread. Returns false if the
+        // input could not be read or the output could not be written.
+        bool render(AudioProcessor* processor);
+
+        // Block until a startStreaming() render has finished
+        void waitForCompletion();
+
+        // Valid once rendering has finished
+        OfflineRenderStats getRenderStats() const { return stats_; }
+        bool outputWritten() const { return output_ok_; }
+
+        // Rendered output trimmed to the input length - for in-memory golden comparisons
+        ConstAudioBlock getOutput() const;
+    };
+
+    std::unique_ptr<OfflineAudioInterface> createOfflineInterface(const OfflineRenderOptions& options);
+
+} // namespace Syntri
@@ -0,0 +1,69 @@
+// include/syntri/perf_counters.h
+// Per-thread hardware performance counters (Linux perf_event_open) read around each callback
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace Syntri {
+
+    enum class PerfCounter {
+        CYCLES,
+        INSTRUCTIONS,
+        L1D_MISSES,         // L1 data cache read misses
+        LLC_MISSES,         // Last-level cache misses
+        BRANCH_MISSES
+    };
+
+    constexpr int PERF_COUNTER_COUNT = 5;
+
+    const char* perfCounterName(PerfCounter counter);
+
+    struct PerfCounterValues {
+        std::array<std::uint64_t, PERF_COUNTER_COUNT> values{};
+
+        std::uint64_t operator[](PerfCounter counter) const { return values[static_cast<int>(counter)]; }
+
+        // Counts accumulated from `before` to `after` (counters only grow)
+        static PerfCounterValues difference(const PerfCounterValues& after, const PerfCounterValues& before);
+    };
+
+    // Counters for the calling thread, user-space only.
+    //
+    // open() and close() are not real-time safe; read() is. On x86 with
+    // user-space rdpmc enabled (the kernel default) read() never leaves user
+    // space. Otherwise it falls back to one read() syscall per counter, which
+    // the real-time safety checker deliberately ignores.
+    //
+    // Counters that the kernel or CPU refuse (no PMU in a VM,
+    // perf_event_paranoid > 2, ...) are simply left out of availableMask().
+    class PerfCounterGroup {
+    private:
+        std::array<int, PERF_COUNTER_COUNT> fds_;
+        std::array<void*, PERF_COUNTER_COUNT> pages_;     // perf_event_mmap_page per counter
+        std::uint32_t available_mask_;
+
+        std::uint64_t readCounter(int index) const;
+
+    public:
+        PerfCounterGroup();
+        ~PerfCounterGroup();
+
+        PerfCounterGroup(const PerfCounterGroup&) = delete;
+        PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+        // Must be called on the thread to be measured. Returns true if at
+        // least one counter opened; `notes` explains what is missing.
+        bool open(std::string* notes = nullptr);
+        void close();
+
+        bool isOpen() const { return available_mask_ != 0; }
+        std::uint32_t availableMask() const { return available_mask_; }
+        bool isAvailable(PerfCounter counter) const { return (available_mask_ >> static_cast<int>(counter)) & 1u; }
+
+        // Current totals; unavailable counters read as zero
+        void read(PerfCounterValues& values) const;
+    };
+
+} // namespace Syntri
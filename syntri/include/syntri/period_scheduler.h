@@ -0,0 +1,73 @@
+// include/syntri/period_scheduler.h
+// Absolute-deadline period timer for software-timed backends - sleep close, then spin onto the boundary
+#pragma once
+
+#include <cstdint>
+
+namespace Syntri {
+
+    // Spinning on a single core only steals time from everything else
+    bool defaultPeriodSpinEnabled();
+
+    struct PeriodSchedulerOptions {
+        bool spin = defaultPeriodSpinEnabled();     // false = sleep only
+        std::int64_t initial_spin_margin_ns = 100000;
+        std::int64_t min_spin_margin_ns = 10000;
+        double max_spin_fraction = 0.5;             // Never spin for more of a period than this
+    };
+
+    struct PeriodWake {
+        long long period_index = 0;         // Boundary reached; period 0 is start()
+        std::int64_t lateness_ns = 0;       // Wake time minus the boundary
+        std::int64_t spin_ns = 0;           // Spent spinning after the sleep
+        long long skipped_periods = 0;      // Boundaries passed while we were more than a period late
+    };
+
+    // Period boundaries are start + frames_to_ns(n * buffer_size), computed from
+    // the frame count each time so rounding never accumulates. Each wait
+    // sleeps with clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME) until the spin
+    // margin before the boundary, then busy-waits onto it. The margin follows a
+    // decaying peak of the measured sleep overshoot, so it grows at once after a
+    // late wake-up and shrinks slowly while wake-ups are prompt.
+    //
+    // One thread drives a scheduler; there is no locking.
+    class PeriodScheduler {
+    private:
+        PeriodSchedulerOptions options_;
+        int sample_rate_;
+        int buffer_size_;
+        std::uint64_t start_ns_;
+        std::int64_t period_ns_;
+        long long next_period_;
+
+        std::int64_t overshoot_peak_ns_;    // Decaying peak of sleep overshoot
+        std::int64_t spin_margin_ns_;
+
+        void sleepUntil(std::uint64_t target_ns) const;
+        void adaptMargin(std::int64_t overshoot_ns);
+        std::uint64_t claimNextBoundary(std::uint64_t now_ns, PeriodWake& wake);
+
+    public:
+        explicit PeriodScheduler(const PeriodSchedulerOptions& options = PeriodSchedulerOptions());
+
+        // Anchor period 0 at the current time, or at `start_ns` on a virtual clock
+        void start(int sample_rate, int buffer_size);
+        void start(int sample_rate, int buffer_size, std::uint64_t start_ns);
+
+        // Block until the next boundary. If we are already more than a period
+        // behind, the missed boundaries are skipped rather than fired back to back.
+        PeriodWake waitForNextPeriod();
+
+        // Virtual clocks: the wake a caller at `now_ns` gets without sleeping.
+        // If `now_ns` is before the boundary the caller jumps to it (lateness 0).
+        PeriodWake advance(std::uint64_t now_ns);
+
+        std::uint64_t deadlineNanoseconds(long long period_index) const;
+        std::int64_t getPeriodNanoseconds() const { return period_ns_; }
+        std::int64_t getSpinMarginNanoseconds() const { return spin_margin_ns_; }
+
+        // The clock boundaries are expressed in (CLOCK_MONOTONIC on Linux)
+        static std::uint64_t nowNanoseconds();
+    };
+
+} // namespace Syntri
@@ -0,0 +1,133 @@
+// include/syntri/processing_graph.h
+// Processor graph - nodes are AudioProcessors, edges are channels, run from a precompiled level plan
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include "syntri/worker_pool.h"
+#include <vector>
+
+namespace Syntri {
+
+    // Pseudo-nodes for the graph's own inputs and outputs
+    constexpr int GRAPH_INPUT_NODE = -1;
+    constexpr int GRAPH_OUTPUT_NODE = -2;
+
+    // A DAG of processors that is itself an AudioProcessor, so a whole chain
+    // (input strips -> groups -> personal mixes -> output protection) can be
+    // streamed or hot-swapped as one unit.
+    //
+    // An edge carries one channel from a node output (or a graph input) to a
+    // node input (or a graph output). Several edges into the same input are
+    // summed; an input with no edge reads silence.
+    //
+    // compile() sorts the nodes into levels - a node's level is one past the
+    // deepest node feeding it - and gives every intermediate channel a
+    // lifetime from the level that writes it to the last level that reads
+    // it. Channels whose lifetimes do not overlap share a buffer, so the pool
+    // is as small as the widest point of the graph rather than the sum of all
+    // channels. Nodes of one level never depend on each other; with a worker
+    // pool attached they run in parallel.
+    //
+    // processAudio() follows the plan without allocating or locking. Graph
+    // editing and compile() are control-thread only: build a new graph and
+    // hot-swap it rather than editing one that is streaming. Node processors
+    // must not use the graph's worker pool themselves.
+    class ProcessingGraph : public AudioProcessor {
+    public:
+        ProcessingGraph(int num_inputs, int num_outputs);
+
+        ProcessingGraph(const ProcessingGraph&) = delete;
+        ProcessingGraph& operator=(const ProcessingGraph&) = delete;
+
+        // Returns the node id (0, 1, ...); the processor is not owned
+        int addNode(AudioProcessor* processor, int num_inputs, int num_outputs);
+
+        // from = GRAPH_INPUT_NODE or a node, to = GRAPH_OUTPUT_NODE or a node.
+        // False on unknown nodes or channels out of range.
+        bool connect(int from_node, int from_channel, int to_node, int to_channel);
+
+        // Build the level plan and buffer pool for blocks of up to max_frames.
+        // False (and nothing runs) if the edges form a cycle.
+        bool compile(int max_frames);
+        bool isCompiled() const { return compiled_; }
+
+        void setWorkerPool(RealtimeWorkerPool* pool) { worker_pool_ = pool; }
+
+        // Valid after compile()
+        int getNumLevels() const { return static_cast<int>(levels_.size()); }
+        int getNodeLevel(int node) const { return nodes_[static_cast<size_t>(node)].level; }
+        int getPoolChannelCount() const { return pool_channels_; }
+        int getIntermediateChannelCount() const { return intermediate_channels_; }
+
+        // AudioProcessor
+        using AudioProcessor::processAudio;
+        void processAudio(const ConstAudioBlock& inputs, const AudioBlock& outputs) override;
+        bool usesAudioBlocks() const override { return true; }
+
+        // Forwarded to every node; recompiles if the blocks grew
+        void setupChanged(int sample_rate, int buffer_size) override;
+
+    private:
+        struct Edge {
+            int from_node;
+            int from_channel;
+            int to_node;
+            int to_channel;
+        };
+
+        // Sum of several sources into one buffer, run just before its node
+        struct SumStep {
+            AudioSample* destination;
+            int first_source;       // Into source_table_
+            int num_sources;
+        };
+
+        struct Node {
+            AudioProcessor* processor;
+            int num_inputs;
+            int num_outputs;
+            LegacyProcessorBridge legacy_bridge;
+
+            // Compiled plan
+            int level = 0;
+            int input_table = 0;        // num_inputs entries in source_table_
+            int output_table = 0;       // num_outputs entries in output_table_
+            int first_sum = 0;
+            int num_sums = 0;
+        };
+
+        // A source_table_ entry that must point at a host input channel
+        struct InputPatch {
+            int entry;
+            int input_channel;
+        };
+
+        int num_inputs_;
+        int num_outputs_;
+        int max_frames_;
+        bool compiled_;
+        RealtimeWorkerPool* worker_pool_;
+
+        std::vector<Node> nodes_;
+        std::vector<Edge> edges_;
+
+        // Compiled plan
+        std::vector<std::vector<int>> levels_;
+        std::vector<const AudioSample*> source_table_;  // Node inputs and sum sources
+        std::vector<AudioSample*> output_table_;        // Node outputs
+        std::vector<SumStep> sums_;
+        std::vector<InputPatch> input_patches_;
+        std::vector<int> graph_output_sources_;         // [first, count] per graph output, into source_table_
+        AudioBlockStorage pool_;
+        AudioBlockStorage silence_;
+        int pool_channels_;
+        int intermediate_channels_;
+        int block_frames_;                              // Frames of the block being rendered
+        int running_level_;                             // Level handed to the worker pool
+
+        void runNode(int node);
+        static void runNodeTask(void* context, int task_index);
+        void sumInto(AudioSample* destination, int first_source, int num_sources, int frames) const;
+    };
+
+} // namespace Syntri
@@ -0,0 +1,155 @@
+// include/syntri/realtime_metrics.h
+// Wait-free audio-thread metrics with log-scale histograms for tail percentiles
+#pragma once
+
+#include "syntri/perf_counters.h"
+#include "syntri/types.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Syntri {
+
+    // Log-linear buckets: 8 sub-buckets per power of two, values below 8 are exact.
+    // Relative bucket width is at most 12.5%, covering 0 .. 2^40 ns (~18 minutes);
+    // larger values land in the last bucket.
+    constexpr int HISTOGRAM_SUB_BUCKET_BITS = 3;
+    constexpr int HISTOGRAM_SUB_BUCKETS = 1 << HISTOGRAM_SUB_BUCKET_BITS;
+    constexpr int HISTOGRAM_MAX_EXPONENT = 39;
+    constexpr int HISTOGRAM_BUCKET_COUNT =
+        (HISTOGRAM_MAX_EXPONENT - HISTOGRAM_SUB_BUCKET_BITS + 2) * HISTOGRAM_SUB_BUCKETS;
+
+    // DSP load is recorded in hundredths of a percent of the buffer period
+    constexpr std::uint64_t DSP_LOAD_UNITS_PER_PERCENT = 100;
+
+    int histogramBucketIndex(std::uint64_t value);
+    std::uint64_t histogramBucketUpperBound(int index);
+
+    // Plain copy of a histogram, safe to inspect on any thread
+    struct HistogramSnapshot {
+        std::array<std::uint64_t, HISTOGRAM_BUCKET_COUNT> buckets{};
+        std::uint64_t count = 0;
+        std::uint64_t sum = 0;
+        std::uint64_t max = 0;
+
+        // Upper bound of the bucket holding the q-th quantile (q in [0, 1]),
+        // clamped to the largest recorded value
+        std::uint64_t percentile(double q) const;
+        double mean() const;
+
+        // Counts recorded between two snapshots of the same histogram.
+        // max is carried over from `newer` since it cannot be windowed.
+        static HistogramSnapshot difference(const HistogramSnapshot& newer, const HistogramSnapshot& older);
+    };
+
+    // Tail summary in milliseconds (or percent for DSP load)
+    struct PercentileSummary {
+        double mean = 0.0;
+        double p50 = 0.0;
+        double p99 = 0.0;
+        double p999 = 0.0;
+        double max = 0.0;
+    };
+
+    // Hardware counts summed over the measured callbacks of one processor
+    struct HardwareCounterSummary {
+        std::uint32_t available_mask = 0;       // Bit per PerfCounter that could be opened
+        std::uint64_t callbacks = 0;
+        PerfCounterValues totals;
+
+        bool isAvailable(PerfCounter counter) const { return (available_mask >> static_cast<int>(counter)) & 1u; }
+        double perCallback(PerfCounter counter) const;
+        double instructionsPerCycle() const;
+        double missesPerKiloInstruction(PerfCounter counter) const;
+    };
+
+    struct MetricsSnapshot {
+        std::uint64_t callback_count = 0;
+        std::uint64_t xrun_count = 0;
+        double period_ms = 0.0;
+
+        HistogramSnapshot callback_duration_ns;
+        HistogramSnapshot dsp_load;             // DSP_LOAD_UNITS_PER_PERCENT per percent
+        HistogramSnapshot wake_jitter_ns;
+        HardwareCounterSummary hardware_counters;   // Empty unless counters were enabled
+
+        PercentileSummary callbackDurationMs() const;
+        PercentileSummary dspLoadPercent() const;
+        PercentileSummary wakeJitterMs() const;
+
+        // Mean/max summary for AudioInterface::getMetrics()
+        SimpleMetrics toSimpleMetrics(double latency_ms) const;
+    };
+
+    // Single-writer histogram: only the owning audio thread records
+    class AtomicHistogram {
+    private:
+        std::array<std::atomic<std::uint64_t>, HISTOGRAM_BUCKET_COUNT> buckets_;
+        std::atomic<std::uint64_t> count_;
+        std::atomic<std::uint64_t> sum_;
+        std::atomic<std::uint64_t> max_;
+
+        static void increment(std::atomic<std::uint64_t>& counter, std::uint64_t amount) {
+            counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+    public:
+        AtomicHistogram();
+
+        void record(std::uint64_t value) {
+            increment(buckets_[histogramBucketIndex(value)], 1);
+            increment(count_, 1);
+            increment(sum_, value);
+            if (value > max_.load(std::memory_order_relaxed)) {
+                max_.store(value, std::memory_order_relaxed);
+            }
+        }
+
+        void copyTo(HistogramSnapshot& snapshot) const;
+        void reset();
+    };
+
+    // Metrics block updated wait-free by the audio thread and snapshotted by
+    // control threads. Updates are published through a sequence counter so a
+    // snapshot never mixes two callbacks.
+    class RealtimeMetrics {
+    private:
+        std::atomic<std::uint32_t> sequence_;
+        std::atomic<std::uint64_t> callback_count_;
+        std::atomic<std::uint64_t> xrun_count_;
+        std::atomic<std::uint64_t> period_ns_;
+
+        AtomicHistogram callback_duration_ns_;
+        AtomicHistogram dsp_load_;
+        AtomicHistogram wake_jitter_ns_;
+
+        std::atomic<std::uint32_t> counter_mask_;
+        std::atomic<std::uint64_t> counter_callbacks_;
+        std::array<std::atomic<std::uint64_t>, PERF_COUNTER_COUNT> counter_totals_;
+
+        void beginWrite();
+        void endWrite();
+
+    public:
+        RealtimeMetrics();
+
+        RealtimeMetrics(const RealtimeMetrics&) = delete;
+        RealtimeMetrics& operator=(const RealtimeMetrics&) = delete;
+
+        // Control thread, while the audio thread is not recording
+        void reset();
+        void setPeriod(int sample_rate, int buffer_size);
+        void setHardwareCounterMask(std::uint32_t available_mask);
+
+        // Audio thread only
+        void recordCallback(std::uint64_t duration_ns, std::int64_t wake_jitter_ns);
+        void recordXrun();
+        void recordHardwareCounters(const PerfCounterValues& callback_counts);
+        // Start the counter totals over for a new processor; the mask is kept
+        void resetHardwareCounters();
+
+        // Any thread
+        MetricsSnapshot snapshot() const;
+    };
+
+} // namespace Syntri
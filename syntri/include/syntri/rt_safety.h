@@ -0,0 +1,65 @@
+// include/syntri/rt_safety.h
+// Real-time safety checker - flags allocation, locking and blocking calls inside audio callbacks
+#pragma once
+
+namespace Syntri {
+
+    enum class RealtimeViolationAction {
+        REPORT,     // Print the call and its stack to stderr, keep running
+        ABORT       // Print, then abort() - for CI runs
+    };
+
+    // Reports printed per process; later violations are only counted
+    constexpr int RT_SAFETY_MAX_REPORTS = 16;
+
+    // Stack frames printed per report
+    constexpr int RT_SAFETY_BACKTRACE_DEPTH = 32;
+
+    // Marks the calling thread as inside an audio callback for its lifetime.
+    // The interfaces wrap every processAudio() call in one (see invokeProcessor),
+    // so processors never need to create these themselves. Nests; costs two
+    // thread-local increments.
+    class RealtimeCallbackScope {
+    public:
+        RealtimeCallbackScope();
+        ~RealtimeCallbackScope();
+
+        RealtimeCallbackScope(const RealtimeCallbackScope&) = delete;
+        RealtimeCallbackScope& operator=(const RealtimeCallbackScope&) = delete;
+    };
+
+    // Suspends checking on the calling thread - for deliberate, reviewed
+    // exceptions such as a one-off diagnostic print
+    class RealtimeSafetyExemption {
+    public:
+        RealtimeSafetyExemption();
+        ~RealtimeSafetyExemption();
+
+        RealtimeSafetyExemption(const RealtimeSafetyExemption&) = delete;
+        RealtimeSafetyExemption& operator=(const RealtimeSafetyExemption&) = delete;
+    };
+
+    // True while the calling thread is inside a callback and not exempt
+    bool isInRealtimeCallback();
+
+    // True when the interposer (SyntriRtSafety) is linked into this binary.
+    // Without it nothing is intercepted and the violation count stays zero.
+    bool realtimeSafetyChecksInstalled();
+
+    // Initial action is REPORT, or ABORT if SYNTRI_RT_SAFETY_ABORT=1 is set
+    void setRealtimeViolationAction(RealtimeViolationAction action);
+    RealtimeViolationAction getRealtimeViolationAction();
+
+    long long getRealtimeViolationCount();
+    void resetRealtimeViolationCount();
+
+    // Name of the most recently intercepted call ("" if none)
+    const char* getLastRealtimeViolation();
+
+    namespace detail {
+        // Called by the interposer. Must not allocate or lock.
+        void markRealtimeSafetyChecksInstalled();
+        void reportRealtimeViolation(const char* function);
+    }
+
+} // namespace Syntri
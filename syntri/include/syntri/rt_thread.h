@@ -0,0 +1,70 @@
+// include/syntri/rt_thread.h
+// Real-time thread setup - scheduling class, CPU pinning, memory locking, denormal flushing
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Syntri {
+
+    // SCHED_FIFO priority for audio threads: above threaded IRQ handlers (50)
+    // so interrupt bursts cannot delay a callback, below the kernel's
+    // watchdog and migration threads (99)
+    constexpr int REALTIME_DEFAULT_PRIORITY = 80;
+
+    // Stack touched up front so the first callbacks never page-fault
+    constexpr std::size_t REALTIME_DEFAULT_STACK_PREFAULT = 256 * 1024;
+
+    struct RealtimeThreadOptions {
+        bool use_realtime_priority = true;      // SCHED_FIFO / TIME_CRITICAL, falls back silently
+        int priority = REALTIME_DEFAULT_PRIORITY;
+        std::vector<int> cpu_affinity;          // Empty = leave the scheduler's choice
+        bool lock_memory = true;                // mlockall(current + future), once per process
+        std::size_t prefault_stack_bytes = REALTIME_DEFAULT_STACK_PREFAULT;
+        bool flush_denormals = true;            // FTZ + DAZ on this thread
+    };
+
+    // What was actually applied - every step degrades gracefully without privileges
+    struct RealtimeThreadStatus {
+        bool configured = false;        // configureCurrentThreadForAudio() has run
+        bool realtime_priority = false;
+        int priority = 0;               // Effective priority (0 = normal scheduling)
+        bool affinity_set = false;
+        bool memory_locked = false;
+        bool stack_prefaulted = false;
+        bool denormals_flushed = false;
+        std::string notes;              // Human-readable reasons for any fallback
+    };
+
+    // Apply every option to the calling thread. Call at the top of an audio
+    // (or DSP worker) thread, before the first callback. Not real-time safe.
+    RealtimeThreadStatus configureCurrentThreadForAudio(const RealtimeThreadOptions& options);
+
+    // Individual steps, each returning whether it took effect
+    bool setCurrentThreadRealtimePriority(int priority, int* applied_priority = nullptr, std::string* notes = nullptr);
+    bool setCurrentThreadAffinity(const std::vector<int>& cpus);
+    bool lockProcessMemory(std::string* notes = nullptr);
+    void prefaultStack(std::size_t bytes);
+
+    // Flush-to-zero and denormals-are-zero for the calling thread's float unit.
+    // Returns false on CPUs where this build cannot control them.
+    bool enableDenormalFlush();
+    bool denormalFlushEnabled();
+
+    // Flushes denormals for one scope and restores the previous mode - for
+    // DSP run on a thread this code does not own (e.g. a synchronous render)
+    class ScopedDenormalFlush {
+    private:
+        unsigned long long saved_state_;
+        bool restore_;
+
+    public:
+        ScopedDenormalFlush();
+        ~ScopedDenormalFlush();
+
+        ScopedDenormalFlush(const ScopedDenormalFlush&) = delete;
+        ScopedDenormalFlush& operator=(const ScopedDenormalFlush&) = delete;
+    };
+
+} // namespace Syntri
@@ -0,0 +1,94 @@
+// include/syntri/signal_generator.h
+// Test-signal generator - rotator sine, log sweep, white/pink noise, impulse train
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include <cstdint>
+#include <memory>
+
+namespace Syntri {
+
+    enum class SignalType {
+        SILENCE,
+        SINE,
+        LOG_SWEEP,          // sweep_start_hz -> sweep_end_hz over sweep_seconds, then repeats
+        WHITE_NOISE,        // Uniform, peak = amplitude
+        PINK_NOISE,         // -3 dB/octave, peak roughly amplitude
+        IMPULSE_TRAIN       // One-sample clicks, `frequency` per second
+    };
+
+    struct SignalSettings {
+        SignalType type = SignalType::SINE;
+        double frequency = 440.0;
+        double amplitude = 0.1;
+        double sweep_start_hz = 20.0;
+        double sweep_end_hz = 20000.0;
+        double sweep_seconds = 10.0;
+        std::uint32_t seed = 0x5EED1234u;
+    };
+
+    // Sine lanes advanced together: one complex rotation per lane per step
+    constexpr int SIGNAL_ROTATOR_LANES = 8;
+
+    // Rotators are re-derived from the exact phase this often
+    constexpr int SIGNAL_RESYNC_FRAMES = 1024;
+
+    // Generates one signal a whole block at a time.
+    //
+    // The sine runs SIGNAL_ROTATOR_LANES phasors side by side (a loop the
+    // compiler vectorizes) and re-derives them from a double-precision phase
+    // every SIGNAL_RESYNC_FRAMES, so neither phase nor amplitude drifts no
+    // matter how long it runs. The sweep uses a chirp rotator resynced from
+    // the closed-form sweep phase in short chunks. Nothing here allocates.
+    class SignalGenerator {
+    private:
+        SignalSettings settings_;
+        int sample_rate_;
+
+        // Sine: unit phasors for the next SIGNAL_ROTATOR_LANES samples
+        double phase_;              // Exact phase of the next sample, [0, 2pi)
+        float lane_re_[SIGNAL_ROTATOR_LANES];
+        float lane_im_[SIGNAL_ROTATOR_LANES];
+        float step_re_;             // Rotation by SIGNAL_ROTATOR_LANES samples
+        float step_im_;
+        int frames_since_sync_;     // >= SIGNAL_RESYNC_FRAMES forces a resync
+
+        long long sweep_position_;  // Frames into the current sweep
+        double impulse_countdown_;  // Samples until the next click
+
+        std::uint32_t noise_state_[SIGNAL_ROTATOR_LANES];
+        float pink_state_[7];
+
+        void resyncSine();
+        void advanceLanes(int samples_used);
+
+        void renderSine(AudioSample* destination, int num_samples);
+        void renderSweep(AudioSample* destination, int num_samples);
+        void renderWhite(AudioSample* destination, int num_samples, float amplitude);
+        void renderPink(AudioSample* destination, int num_samples);
+        void renderImpulses(AudioSample* destination, int num_samples);
+
+    public:
+        explicit SignalGenerator(const SignalSettings& settings = SignalSettings());
+
+        // Not real-time safe against a concurrent render(); call before
+        // streaming or from the audio thread itself
+        void setSettings(const SignalSettings& settings);
+        const SignalSettings& getSettings() const { return settings_; }
+
+        void setSampleRate(int sample_rate);
+
+        // Restart phase, sweep, noise sequence and impulse timing
+        void reset();
+
+        // One channel
+        void render(AudioSample* destination, int num_samples);
+
+        // Same signal on every channel of the block
+        void render(const AudioBlock& block);
+    };
+
+    // Processor that plays a test signal on every output channel (line checks)
+    std::unique_ptr<AudioProcessor> createSignalProcessor(const SignalSettings& settings);
+
+} // namespace Syntri
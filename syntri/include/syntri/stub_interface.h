@@ -0,0 +1,206 @@
+// include/syntri/stub_interface.h
+// Software-timed AudioInterface with no hardware - deadline checks, xrun recovery and fault injection
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include "syntri/period_scheduler.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Syntri {
+
+    constexpr int STUB_CHANNEL_COUNT = 8;
+
+    // What the simulated device plays for a period whose buffer was late
+    enum class XrunRecovery {
+        SILENCE,            // Zeros
+        REPEAT_LAST,        // The last buffer that arrived in time, again
+        CROSSFADE           // Last good buffer faded out, silence, next good buffer faded in
+    };
+
+    // Test hook, called on the audio thread with every period the device
+    // plays. `recovered` is true when the period was filled by XrunRecovery.
+    using StubOutputTap = std::function<void(const ConstAudioBlock& played, bool recovered)>;
+
+    struct StubInterfaceOptions {
+        XrunRecovery recovery = XrunRecovery::SILENCE;
+        PeriodSchedulerOptions scheduler;
+        StubOutputTap output_tap;
+        bool virtual_time = false;  // No thread - the caller drives callbacks with stepBuffers()
+    };
+
+    // Streams on its own thread, one callback per buffer period. A callback
+    // that finishes after the next period boundary has missed its slot: it
+    // counts as an underrun and the device plays the recovery output instead.
+    // Boundaries skipped while the thread was more than a period behind are
+    // underruns too.
+    //
+    // Fault injection (any thread, next callback) adds busy-wait load or a
+    // one-off stall around processAudio, so overload behaviour can be
+    // measured without a slow processor. Load above 100% keeps the audio
+    // thread permanently busy - disable real-time priority first on machines
+    // with few cores.
+    //
+    // With virtual_time set, startStreaming() starts no thread. Each
+    // stepBuffers() call runs callbacks back to back on the caller's thread
+    // against a simulated clock that jumps to each boundary. Injected stalls
+    // and load advance that clock instead of sleeping or spinning, and the
+    // deadline check and the recorded callback durations use simulated time
+    // only, so xrun counts and DSP load are exactly reproducible. The real
+    // processing time is not measured; use a real-time stream or the bench
+    // for that.
+    //
+    // reconfigure() while streaming: the next callback's output fades out,
+    // the device then plays silence without calling the processor while
+    // setupChanged() runs on the caller's thread, and at the following
+    // boundary the audio thread swaps to the preallocated buffers and fades
+    // the first new-size buffer in. The gap is a period or two, not a restart.
+    // In virtual time the caller has to drive those periods, so reconfigure()
+    // steps them itself - the fade-out and fade-in callbacks are counted.
+    //
+    // swapProcessor() hands the audio thread a new processor at the next
+    // boundary. While a crossfade runs both processors see the same input
+    // and their outputs are mixed; afterwards the audio thread hands the old
+    // pointer back, which is the caller's proof it will never be called again.
+    // stopStreaming() waits for a swap or reconfigure() in progress; a swap
+    // that still cannot complete returns nullptr rather than the old pointer.
+    class StubAudioInterface : public AudioInterface {
+    private:
+        // Everything the callback touches for one configuration. Built off
+        // the audio thread; the audio thread only swaps pointers to it.
+        struct StreamBuffers {
+            int sample_rate = 0;
+            int buffer_size = 0;
+            AudioBlockStorage input;
+            AudioBlockStorage output;
+            LegacyProcessorBridge legacy_bridge;
+            AudioBlockStorage played;       // What the simulated device plays
+            AudioBlockStorage last_good;    // The last buffer that arrived in time
+            AudioBlockStorage crossfade;    // Outgoing processor's output during a swap
+
+            void allocate(int new_sample_rate, int new_buffer_size);
+        };
+
+        // reconfigure() handshake; IDLE is the only state outside a switch
+        enum class SwitchState {
+            IDLE,
+            FADE_OUT,       // Requested: fade the next callback's output out, then park
+            PARKED,         // Audio thread plays silence, processor untouched
+            READY           // New buffers published: swap at the next boundary
+        };
+
+        StubInterfaceOptions options_;
+        bool initialized_;
+        std::atomic<bool> streaming_;
+        int sample_rate_;
+        int buffer_size_;
+        AudioProcessor* processor_;         // Control side: the processor installed last
+        HardwareType hardware_type_;
+
+        // Streaming thread and the buffers it works in. Buffers are sized in
+        // startStreaming() and reconfigure() so the callback never allocates.
+        std::thread audio_thread_;
+        std::unique_ptr<StreamBuffers> buffers_;
+        std::unique_ptr<StreamBuffers> pending_buffers_;    // Next configuration, then the retired one
+        bool in_recovery_;
+        bool fade_in_next_;
+        std::atomic<XrunRecovery> recovery_;
+
+        std::atomic<SwitchState> switch_state_;
+
+        // Processor hand-over. The audio thread owns the active and outgoing
+        // pointers; control threads publish through pending_processor_ and
+        // learn the old one is unused through retired_processor_.
+        AudioProcessor* active_processor_;
+        AudioProcessor* outgoing_processor_;    // Still fading out
+        int crossfade_frames_;
+        int crossfade_done_;
+        std::atomic<AudioProcessor*> pending_processor_;
+        std::atomic<int> pending_crossfade_frames_;
+        std::atomic<AudioProcessor*> retired_processor_;
+
+        // Serializes reconfigure() and swapProcessor()
+        std::mutex control_mutex_;
+
+        // Written wait-free by the audio thread, snapshotted by getMetrics()
+        RealtimeMetrics metrics_;
+
+        // Applied by the audio thread to itself before its first period
+        RealtimeThreadOptions thread_options_;
+        RealtimeThreadStatus thread_status_;
+        mutable std::mutex thread_status_mutex_;
+
+        std::atomic<bool> hardware_counters_enabled_;
+        PerfCounterGroup counters_;
+
+        std::atomic<double> injected_load_;
+        std::atomic<std::int64_t> pending_stall_ns_;
+
+        // Virtual-time mode: boundaries on a simulated clock starting at 0
+        PeriodScheduler virtual_clock_;
+        std::uint64_t virtual_now_ns_;
+
+        void audioThreadMain();
+        void openHardwareCounters();
+        // Returns how long the callback took - simulated time in virtual mode.
+        // A configuration switch re-anchors `clock` at this period's boundary.
+        std::int64_t processPeriod(PeriodScheduler& clock, const PeriodWake& wake);
+        // False if the outgoing processor ran too (crossfade)
+        bool runProcessors(StreamBuffers& buffers, std::uint64_t deadline_ticks);
+        void deliverOutput(bool fade_out);
+        void playRecovery();
+        void playParkedSilence();
+        // Control thread: wait (stepping periods in virtual time) until done() holds
+        template <typename Done>
+        bool waitForAudioThread(Done done);
+        void abandonSwitch();
+
+    public:
+        explicit StubAudioInterface(const StubInterfaceOptions& options = StubInterfaceOptions());
+        ~StubAudioInterface() override;
+
+        bool initialize(int sample_rate = SAMPLE_RATE_96K, int buffer_size = BUFFER_SIZE_ULTRA_LOW) override;
+        void shutdown() override;
+        bool isInitialized() const override { return initialized_; }
+
+        HardwareType getType() const override { return hardware_type_; }
+        std::string getName() const override { return "Syntri Stub Interface"; }
+        int getInputChannelCount() const override { return STUB_CHANNEL_COUNT; }
+        int getOutputChannelCount() const override { return STUB_CHANNEL_COUNT; }
+        double getCurrentLatency() const override;
+
+        bool startStreaming(AudioProcessor* processor) override;
+        void stopStreaming() override;
+        bool isStreaming() const override { return streaming_.load(std::memory_order_acquire); }
+        bool reconfigure(int sample_rate, int buffer_size) override;
+        AudioProcessor* swapProcessor(AudioProcessor* next, int crossfade_frames = 0) override;
+
+        SimpleMetrics getMetrics() const override;
+        MetricsSnapshot getMetricsSnapshot() const override { return metrics_.snapshot(); }
+
+        // Defaults as RealtimeThreadOptions except lock_memory, which is off:
+        // locking (mlockall(MCL_FUTURE) plus mallopt tuning) cannot be undone
+        // and applies to the whole process. Set it to opt in.
+        void setRealtimeThreadOptions(const RealtimeThreadOptions& options) override { thread_options_ = options; }
+        RealtimeThreadStatus getRealtimeThreadStatus() const override;
+        void setHardwareCountersEnabled(bool enabled) override;
+
+        void setXrunRecovery(XrunRecovery recovery) { recovery_.store(recovery, std::memory_order_relaxed); }
+        XrunRecovery getXrunRecovery() const { return recovery_.load(std::memory_order_relaxed); }
+
+        // Busy-wait for this share of the period in every callback (0 = off)
+        void setInjectedLoad(double fraction_of_period);
+        // Sleep this long in the next callback, like a page fault or preemption
+        void injectStall(std::int64_t nanoseconds);
+
+        // Virtual-time mode: run `count` callbacks now. Returns how many ran
+        // (0 unless streaming in virtual time).
+        int stepBuffers(int count);
+        std::uint64_t getVirtualTimeNanoseconds() const { return virtual_now_ns_; }
+    };
+
+    std::unique_ptr<StubAudioInterface> createStubInterface(const StubInterfaceOptions& options);
+
+} // namespace Syntri
@@ -0,0 +1,75 @@
+// include/syntri/trace.h
+// Opt-in timeline tracing - callback, stage and worker-task spans exported as Chrome/Perfetto JSON
+#pragma once
+
+#include "syntri/clock.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Syntri {
+
+    constexpr std::size_t TRACE_DEFAULT_CAPACITY = 1 << 16;    // Spans kept; oldest are overwritten
+    constexpr int TRACE_MAX_THREADS = 64;                       // Threads that can be named
+    constexpr int TRACE_THREAD_NAME_SIZE = 32;
+
+    // One completed span. `name` must be a string literal (or otherwise outlive the trace).
+    struct TraceEvent {
+        const char* name;
+        std::uint64_t start_ns;         // clockTimestampToNanoseconds()
+        std::uint64_t duration_ns;
+        std::uint32_t thread_index;     // Dense per-thread id, see setTraceThreadName()
+        std::int32_t arg;               // Span-specific: period, mix or task index (-1 = none)
+    };
+
+    namespace detail {
+        extern std::atomic<bool> tracing_enabled;
+    }
+
+    // Allocate (or reuse) the ring and start recording. Not real-time safe.
+    void startTracing(std::size_t capacity = TRACE_DEFAULT_CAPACITY);
+    void stopTracing();
+    inline bool isTracing() { return detail::tracing_enabled.load(std::memory_order_relaxed); }
+
+    // Drop everything recorded so far (tracing state unchanged)
+    void clearTrace();
+
+    // Wait-free; a no-op unless tracing. Safe from the audio thread and workers.
+    // Times are readClockTicks() values, converted when the trace is read.
+    void recordTraceEvent(const char* name, std::uint64_t start_ticks, std::uint64_t end_ticks, std::int32_t arg = -1);
+
+    // Label the calling thread's track in the exported trace
+    void setTraceThreadName(const char* name);
+
+    // Spans currently in the ring, oldest first. Not real-time safe.
+    std::vector<TraceEvent> getTraceEvents();
+
+    // Chrome trace-event JSON - opens in chrome://tracing and ui.perfetto.dev
+    bool writeChromeTrace(const std::string& path, std::string& error);
+
+    // Records a span from construction to destruction. When tracing is off
+    // this costs one relaxed load.
+    class TraceScope {
+    private:
+        const char* name_;
+        std::uint64_t start_ticks_;
+        std::int32_t arg_;
+        bool active_;
+
+    public:
+        explicit TraceScope(const char* name, std::int32_t arg = -1)
+            : name_(name), start_ticks_(0), arg_(arg), active_(isTracing()) {
+            if (active_) start_ticks_ = readClockTicks();
+        }
+
+        ~TraceScope() {
+            if (active_) recordTraceEvent(name_, start_ticks_, readClockTicks(), arg_);
+        }
+
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+    };
+
+} // namespace Syntri
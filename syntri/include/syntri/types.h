@@ -24,24 +24,40 @@ namespace Syntri {
         BEHRINGER_X32,
         FOCUSRITE_SCARLETT,      // Added
         RME_BABYFACE,           // Added
-        GENERIC_ASIO
+        GENERIC_ASIO,
+        OFFLINE_RENDER           // File-to-file rendering, no device
     };
 
     // Audio sample format (32-bit float)
+    // MultiChannelBuffer is the original callback format; real-time paths
+    // should prefer the planar AudioBlock views in syntri/audio_block.h
     using AudioSample = float;
     using AudioBuffer = std::vector<AudioSample>;
     using MultiChannelBuffer = std::vector<AudioBuffer>;
 
-    // Simple performance metrics (no atomic complexity yet)
+    // Simple performance metrics - summary view of RealtimeMetrics
+    // (see syntri/realtime_metrics.h for tail percentiles)
     struct SimpleMetrics {
         double latency_ms = 0.0;
         double cpu_usage_percent = 0.0;
         int buffer_underruns = 0;
 
+        // Measured on the streaming thread (zero until callbacks have run)
+        long long callback_count = 0;
+        double processing_time_ms = 0.0;    // Average processAudio duration
+        double max_processing_time_ms = 0.0;
+        double jitter_ms = 0.0;             // Average wake-up lateness vs. period deadline
+        double max_jitter_ms = 0.0;
+
         void reset() {
             latency_ms = 0.0;
             cpu_usage_percent = 0.0;
             buffer_underruns = 0;
+            callback_count = 0;
+            processing_time_ms = 0.0;
+            max_processing_time_ms = 0.0;
+            jitter_ms = 0.0;
+            max_jitter_ms = 0.0;
         }
     };
 
@@ -57,6 +73,7 @@ namespace Syntri {
         case HardwareType::FOCUSRITE_SCARLETT: return "Focusrite Scarlett";
         case HardwareType::RME_BABYFACE: return "RME Babyface Pro";
         case HardwareType::GENERIC_ASIO: return "Generic ASIO";
+        case HardwareType::OFFLINE_RENDER: return "Offline Render";
         default: return "Unknown";
         }
     }
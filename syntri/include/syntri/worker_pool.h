@@ -0,0 +1,105 @@
+// include/syntri/worker_pool.h
+// Real-time worker pool - work-stealing parallel-for joined inside one audio callback
+#pragma once
+
+#include "syntri/clock.h"
+#include "syntri/rt_thread.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Syntri {
+
+    // Task entry point: called once for every index in [0, num_tasks)
+    using ParallelTaskFunction = void (*)(void* context, int task_index);
+
+    // Workers spin between batches, so SCHED_FIFO is off by default: a spinning
+    // FIFO thread on a shared core locks out everything below it. Turn it on
+    // only when the workers are pinned to isolated cores.
+    inline RealtimeThreadOptions defaultWorkerThreadOptions() {
+        RealtimeThreadOptions options;
+        options.use_realtime_priority = false;
+        options.lock_memory = false;
+        return options;
+    }
+
+    struct WorkerPoolOptions {
+        int num_workers = -1;                   // -1 = one per remaining hardware thread
+        std::vector<int> cpu_affinity;          // Worker k runs on cpu_affinity[k % size]
+        bool use_isolated_cpus = true;          // If cpu_affinity is empty, pin to isolcpus= CPUs
+        int spin_iterations = 4000;             // Busy-wait rounds before yielding
+        double park_after_idle_ms = 50.0;       // Sleep on a condition variable after this long idle
+        RealtimeThreadOptions thread_options = defaultWorkerThreadOptions();    // Affinity comes from the fields above
+    };
+
+    // CPUs the kernel isolated from the general scheduler (Linux isolcpus=);
+    // empty elsewhere or when none are isolated
+    std::vector<int> getIsolatedCpus();
+
+    // Fixed set of spinning worker threads that the audio thread fans work out to.
+    //
+    // run() splits the task range evenly between the workers and the calling
+    // thread. Each participant drains its own range from the front while idle
+    // participants steal half of someone else's remaining range from the back,
+    // so one slow task (or a preempted worker) does not stall the whole batch.
+    // The caller always joins every task before returning - nothing is ever
+    // left running into the next callback.
+    //
+    // run() itself never allocates or locks. Only one thread may call it at a time.
+    class RealtimeWorkerPool {
+    public:
+        explicit RealtimeWorkerPool(const WorkerPoolOptions& options = WorkerPoolOptions());
+        ~RealtimeWorkerPool();
+
+        RealtimeWorkerPool(const RealtimeWorkerPool&) = delete;
+        RealtimeWorkerPool& operator=(const RealtimeWorkerPool&) = delete;
+
+        int getNumWorkers() const { return num_workers_; }
+
+        // Run function(context, i) for every i in [0, num_tasks) and wait for all
+        // of them. The deadline (a readClockTicks() timestamp) never cuts a
+        // batch short: it is compared with the finish time after the join, and
+        // run() returns false and counts a miss if the batch ended after it.
+        bool run(int num_tasks, ParallelTaskFunction function, void* context, std::uint64_t deadline_ticks);
+        bool run(int num_tasks, ParallelTaskFunction function, void* context);
+
+        // Batches that completed after their deadline - a count, not a limit
+        long long getDeadlineMisses() const { return deadline_misses_.load(std::memory_order_relaxed); }
+
+    private:
+        // One task range per participant: [tag:16 | begin:24 | end:24]
+        struct alignas(64) Slot {
+            std::atomic<std::uint64_t> range{0};
+        };
+
+        int num_workers_;
+        int spin_iterations_;
+        RealtimeThreadOptions thread_options_;
+        std::uint64_t park_after_ticks_;
+
+        std::unique_ptr<Slot[]> slots_;         // num_workers_ + 1, caller uses the last
+        std::vector<std::thread> threads_;
+
+        alignas(64) std::atomic<std::uint32_t> batch_generation_;
+        std::atomic<ParallelTaskFunction> function_;
+        std::atomic<void*> context_;
+        alignas(64) std::atomic<int> remaining_;
+
+        std::atomic<bool> running_;
+        std::atomic<int> parked_workers_;
+        std::mutex park_mutex_;
+        std::condition_variable park_condition_;
+
+        std::atomic<long long> deadline_misses_;
+
+        void workerMain(int worker_index, int cpu);
+        void participate(int slot_index, std::uint32_t generation, ParallelTaskFunction function, void* context);
+        bool takeOwn(int slot_index, std::uint32_t tag, int& task);
+        bool stealInto(int slot_index, std::uint32_t tag, int& task);
+    };
+
+} // namespace Syntri
@@ -0,0 +1,79 @@
+// src/core/adaptive_buffer.cpp
+// Window judgement and ladder moves for the adaptive buffer size controller
+
+#include "syntri/adaptive_buffer.h"
+#include "syntri/log.h"
+#include <algorithm>
+
+namespace Syntri {
+
+    AdaptiveBufferController::AdaptiveBufferController(AudioInterface& interface, int sample_rate, int buffer_size,
+        const AdaptiveBufferOptions& options)
+        : interface_(interface), options_(options), sample_rate_(std::max(sample_rate, 1)), level_(0),
+        stable_seconds_(0.0) {
+        if (options_.buffer_sizes.empty()) {
+            options_.buffer_sizes.push_back(buffer_size);
+        }
+        std::sort(options_.buffer_sizes.begin(), options_.buffer_sizes.end());
+
+        const int top = static_cast<int>(options_.buffer_sizes.size()) - 1;
+        while (level_ < top && options_.buffer_sizes[static_cast<size_t>(level_)] < buffer_size) {
+            ++level_;
+        }
+        window_start_ = interface_.getMetricsSnapshot();
+    }
+
+    AdaptiveBufferAction AdaptiveBufferController::update() {
+        const MetricsSnapshot now = interface_.getMetricsSnapshot();
+        const std::uint64_t callbacks = now.callback_count - window_start_.callback_count;
+        const std::uint64_t xruns = now.xrun_count - window_start_.xrun_count;
+
+        // An xrun is judged at once; load needs a full window for its tail to mean anything
+        if (xruns == 0 && callbacks < options_.window_callbacks) {
+            return AdaptiveBufferAction::HOLD;
+        }
+
+        const HistogramSnapshot load = HistogramSnapshot::difference(now.dsp_load, window_start_.dsp_load);
+        const double p999_percent = static_cast<double>(load.percentile(0.999)) / DSP_LOAD_UNITS_PER_PERCENT;
+        window_start_ = now;
+
+        const int top = static_cast<int>(options_.buffer_sizes.size()) - 1;
+        if (xruns > 0 || p999_percent > options_.step_up_load_percent) {
+            stable_seconds_ = 0.0;
+            if (level_ < top) {
+                SYNTRI_LOG_INFO("Adaptive buffer: %llu xruns, p99.9 load %.1f%% - stepping up",
+                    static_cast<unsigned long long>(xruns), p999_percent);
+                if (moveTo(level_ + 1)) return AdaptiveBufferAction::STEP_UP;
+            }
+            return AdaptiveBufferAction::HOLD;
+        }
+
+        if (p999_percent >= options_.step_down_load_percent) {
+            stable_seconds_ = 0.0;
+            return AdaptiveBufferAction::HOLD;
+        }
+
+        stable_seconds_ += static_cast<double>(callbacks) * getBufferSize() / sample_rate_;
+        if (level_ > 0 && stable_seconds_ >= options_.stable_seconds) {
+            SYNTRI_LOG_INFO("Adaptive buffer: stable for %.1f s at p99.9 load %.1f%% - stepping down",
+                stable_seconds_, p999_percent);
+            stable_seconds_ = 0.0;
+            if (moveTo(level_ - 1)) return AdaptiveBufferAction::STEP_DOWN;
+        }
+        return AdaptiveBufferAction::HOLD;
+    }
+
+    bool AdaptiveBufferController::moveTo(int level) {
+        const int buffer_size = options_.buffer_sizes[static_cast<size_t>(level)];
+        if (!interface_.reconfigure(sample_rate_, buffer_size)) {
+            SYNTRI_LOG_WARNING("Adaptive buffer: %s refused buffer size %d", interface_.getName().c_str(), buffer_size);
+            return false;
+        }
+
+        // Judge the new size only on its own callbacks
+        level_ = level;
+        window_start_ = interface_.getMetricsSnapshot();
+        return true;
+    }
+
+} // namespace Syntri
@@ -0,0 +1,113 @@
+// src/core/audio_block.cpp
+// Aligned slab storage behind the planar AudioBlock views
+
+#include "syntri/audio_block.h"
+#include "syntri/audio_kernels.h"
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace Syntri {
+
+    namespace {
+        constexpr int SAMPLES_PER_CACHE_LINE = static_cast<int>(AUDIO_BLOCK_ALIGNMENT / sizeof(AudioSample));
+
+        int paddedStride(int num_frames) {
+            return ((num_frames + SAMPLES_PER_CACHE_LINE - 1) / SAMPLES_PER_CACHE_LINE) * SAMPLES_PER_CACHE_LINE;
+        }
+    }
+
+    AudioBlockStorage::AudioBlockStorage()
+        : data_(nullptr), num_channels_(0), num_frames_(0), channel_stride_(0) {
+    }
+
+    AudioBlockStorage::AudioBlockStorage(int num_channels, int num_frames)
+        : AudioBlockStorage() {
+        allocate(num_channels, num_frames);
+    }
+
+    AudioBlockStorage::~AudioBlockStorage() {
+        release();
+    }
+
+    AudioBlockStorage::AudioBlockStorage(AudioBlockStorage&& other) noexcept
+        : data_(other.data_), channel_pointers_(std::move(other.channel_pointers_)),
+        num_channels_(other.num_channels_), num_frames_(other.num_frames_),
+        channel_stride_(other.channel_stride_) {
+        other.data_ = nullptr;
+        other.channel_pointers_.clear();
+        other.num_channels_ = 0;
+        other.num_frames_ = 0;
+        other.channel_stride_ = 0;
+    }
+
+    AudioBlockStorage& AudioBlockStorage::operator=(AudioBlockStorage&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = other.data_;
+            channel_pointers_ = std::move(other.channel_pointers_);
+            num_channels_ = other.num_channels_;
+            num_frames_ = other.num_frames_;
+            channel_stride_ = other.channel_stride_;
+            other.data_ = nullptr;
+            other.channel_pointers_.clear();
+            other.num_channels_ = 0;
+            other.num_frames_ = 0;
+            other.channel_stride_ = 0;
+        }
+        return *this;
+    }
+
+    void AudioBlockStorage::release() {
+        if (data_) {
+            ::operator delete(data_, std::align_val_t(AUDIO_BLOCK_ALIGNMENT));
+            data_ = nullptr;
+        }
+    }
+
+    void AudioBlockStorage::allocate(int num_channels, int num_frames) {
+        release();
+        channel_pointers_.clear();
+
+        num_channels_ = std::max(0, num_channels);
+        num_frames_ = std::max(0, num_frames);
+        channel_stride_ = paddedStride(num_frames_);
+
+        std::size_t total_samples = static_cast<std::size_t>(num_channels_) * channel_stride_;
+        if (total_samples > 0) {
+            data_ = static_cast<AudioSample*>(
+                ::operator new(total_samples * sizeof(AudioSample), std::align_val_t(AUDIO_BLOCK_ALIGNMENT)));
+            std::fill(data_, data_ + total_samples, 0.0f);
+        }
+
+        channel_pointers_.resize(num_channels_);
+        for (int ch = 0; ch < num_channels_; ++ch) {
+            channel_pointers_[ch] = data_ + static_cast<std::size_t>(ch) * channel_stride_;
+        }
+    }
+
+    void AudioBlockStorage::clear() {
+        if (data_) {
+            std::fill(data_, data_ + static_cast<std::size_t>(num_channels_) * channel_stride_, 0.0f);
+        }
+    }
+
+    void clearBlock(const AudioBlock& block) {
+        for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+            Kernels::clear(block.getChannel(ch), block.getNumFrames());
+        }
+    }
+
+    void copyBlock(const ConstAudioBlock& source, const AudioBlock& destination) {
+        int frames = std::min(source.getNumFrames(), destination.getNumFrames());
+        int shared_channels = std::min(source.getNumChannels(), destination.getNumChannels());
+
+        for (int ch = 0; ch < shared_channels; ++ch) {
+            Kernels::copy(source.getChannel(ch), destination.getChannel(ch), frames);
+        }
+        for (int ch = shared_channels; ch < destination.getNumChannels(); ++ch) {
+            Kernels::clear(destination.getChannel(ch), destination.getNumFrames());
+        }
+    }
+
+} // namespace Syntri
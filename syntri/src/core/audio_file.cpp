@@ -0,0 +1,246 @@
+// src/core/audio_file.cpp
+// Minimal RIFF/WAVE and raw float32 reader/writer (byte-order independent)
+
+#include "syntri/audio_file.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Syntri {
+
+    namespace {
+        constexpr std::uint16_t WAVE_FORMAT_PCM = 0x0001;
+        constexpr std::uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+        constexpr std::uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+        // Frames interleaved per write() call
+        constexpr int WRITE_CHUNK_FRAMES = 4096;
+
+        std::uint32_t readU32(const unsigned char* bytes) {
+            return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8) |
+                (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+        }
+
+        std::uint16_t readU16(const unsigned char* bytes) {
+            return static_cast<std::uint16_t>(bytes[0] | (bytes[1] << 8));
+        }
+
+        void writeU32(std::vector<unsigned char>& out, std::uint32_t value) {
+            for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<unsigned char>(value >> shift));
+        }
+
+        void writeU16(std::vector<unsigned char>& out, std::uint16_t value) {
+            out.push_back(static_cast<unsigned char>(value));
+            out.push_back(static_cast<unsigned char>(value >> 8));
+        }
+
+        float floatFromBits(std::uint32_t bits) {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        std::uint32_t bitsFromFloat(float value) {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        bool loadFile(const std::string& path, std::vector<unsigned char>& bytes, std::string& error) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) {
+                error = "Cannot open " + path;
+                return false;
+            }
+            bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return true;
+        }
+
+        // Everything decodeSamples() understands - whole bytes per sample
+        bool isSupportedSampleFormat(std::uint16_t format, int bits) {
+            if (format == WAVE_FORMAT_IEEE_FLOAT) return bits == 32;
+            if (format == WAVE_FORMAT_PCM) return bits == 8 || bits == 16 || bits == 24 || bits == 32;
+            return false;
+        }
+
+        std::string unsupportedFormatError(std::uint16_t format, int bits) {
+            return "Unsupported WAV sample format (" + std::to_string(bits) + "-bit, tag " +
+                std::to_string(format) + ")";
+        }
+
+        bool decodeSamples(const unsigned char* data, std::size_t num_samples, std::uint16_t format,
+            int bits, std::vector<AudioSample>& interleaved, std::string& error) {
+            if (!isSupportedSampleFormat(format, bits)) {
+                error = unsupportedFormatError(format, bits);
+                return false;
+            }
+            interleaved.resize(num_samples);
+
+            if (format == WAVE_FORMAT_IEEE_FLOAT) {
+                for (std::size_t i = 0; i < num_samples; ++i) {
+                    interleaved[i] = floatFromBits(readU32(data + i * 4));
+                }
+            }
+            else if (bits == 8) {
+                // 8-bit WAV is unsigned, centred on 128
+                for (std::size_t i = 0; i < num_samples; ++i) {
+                    interleaved[i] = (static_cast<int>(data[i]) - 128) / 128.0f;
+                }
+            }
+            else if (bits == 16) {
+                for (std::size_t i = 0; i < num_samples; ++i) {
+                    interleaved[i] = static_cast<std::int16_t>(readU16(data + i * 2)) / 32768.0f;
+                }
+            }
+            else if (bits == 24) {
+                for (std::size_t i = 0; i < num_samples; ++i) {
+                    const unsigned char* sample = data + i * 3;
+                    std::int32_t value = static_cast<std::int32_t>(
+                        (static_cast<std::uint32_t>(sample[0]) << 8) | (static_cast<std::uint32_t>(sample[1]) << 16) |
+                        (static_cast<std::uint32_t>(sample[2]) << 24)) >> 8;
+                    interleaved[i] = value / 8388608.0f;
+                }
+            }
+            else {
+                for (std::size_t i = 0; i < num_samples; ++i) {
+                    interleaved[i] = static_cast<float>(static_cast<std::int32_t>(readU32(data + i * 4)) / 2147483648.0);
+                }
+            }
+            return true;
+        }
+
+        bool readWav(const std::string& path, AudioFileInfo& info, std::vector<AudioSample>& interleaved,
+            std::string& error) {
+            std::vector<unsigned char> bytes;
+            if (!loadFile(path, bytes, error)) return false;
+
+            if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0 || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0) {
+                error = path + " is not a RIFF/WAVE file";
+                return false;
+            }
+
+            std::uint16_t format = 0;
+            int bits = 0;
+            bool have_format = false;
+            std::size_t position = 12;
+
+            while (position + 8 <= bytes.size()) {
+                const unsigned char* chunk = bytes.data() + position;
+                std::size_t chunk_size = readU32(chunk + 4);
+                std::size_t body = position + 8;
+                std::size_t available = std::min(chunk_size, bytes.size() - body);
+
+                if (std::memcmp(chunk, "fmt ", 4) == 0 && available >= 16) {
+                    format = readU16(chunk + 8);
+                    info.num_channels = readU16(chunk + 10);
+                    info.sample_rate = static_cast<int>(readU32(chunk + 12));
+                    bits = readU16(chunk + 22);
+                    if (format == WAVE_FORMAT_EXTENSIBLE && available >= 26) {
+                        format = readU16(chunk + 32);   // First two bytes of the sub-format GUID
+                    }
+                    have_format = true;
+                }
+                else if (std::memcmp(chunk, "data", 4) == 0) {
+                    if (!have_format || info.num_channels <= 0 || bits <= 0) {
+                        error = path + " has no usable fmt chunk before its data";
+                        return false;
+                    }
+                    // Compressed formats (ADPCM and friends) have no whole-byte frame size
+                    if (!isSupportedSampleFormat(format, bits)) {
+                        error = path + ": " + unsupportedFormatError(format, bits);
+                        return false;
+                    }
+                    // Streaming writers may leave the size unset - trust the file length then
+                    const std::size_t frame_bytes = static_cast<std::size_t>(info.num_channels) * (bits / 8);
+                    info.num_frames = static_cast<long long>(available / frame_bytes);
+                    return decodeSamples(bytes.data() + body, static_cast<std::size_t>(info.num_frames) * info.num_channels,
+                        format, bits, interleaved, error);
+                }
+
+                position = body + chunk_size + (chunk_size & 1);   // Chunks are word aligned
+            }
+
+            error = path + " has no data chunk";
+            return false;
+        }
+
+        bool readRaw(const std::string& path, int num_channels, AudioFileInfo& info,
+            std::vector<AudioSample>& interleaved, std::string& error) {
+            if (num_channels <= 0) {
+                error = "Raw input needs a channel count";
+                return false;
+            }
+            std::vector<unsigned char> bytes;
+            if (!loadFile(path, bytes, error)) return false;
+
+            info.sample_rate = 0;
+            info.num_channels = num_channels;
+            info.num_frames = static_cast<long long>(bytes.size() / (4 * static_cast<std::size_t>(num_channels)));
+            return decodeSamples(bytes.data(), static_cast<std::size_t>(info.num_frames) * num_channels,
+                WAVE_FORMAT_IEEE_FLOAT, 32, interleaved, error);
+        }
+    }
+
+    bool readAudioFile(const std::string& path, AudioFileFormat format, int raw_channels,
+        AudioFileInfo& info, std::vector<AudioSample>& interleaved, std::string& error) {
+        info = AudioFileInfo();
+        if (format == AudioFileFormat::RAW_FLOAT32) {
+            return readRaw(path, raw_channels, info, interleaved, error);
+        }
+        return readWav(path, info, interleaved, error);
+    }
+
+    bool writeAudioFile(const std::string& path, AudioFileFormat format, const ConstAudioBlock& block,
+        int sample_rate, std::string& error) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            error = "Cannot create " + path;
+            return false;
+        }
+
+        const int channels = block.getNumChannels();
+        const long long frames = block.getNumFrames();
+        const std::uint32_t data_bytes = static_cast<std::uint32_t>(frames * channels * 4);
+
+        std::vector<unsigned char> bytes;
+        if (format == AudioFileFormat::WAV) {
+            bytes.insert(bytes.end(), { 'R', 'I', 'F', 'F' });
+            writeU32(bytes, 4 + (8 + 18) + (8 + 4) + (8 + data_bytes));
+            bytes.insert(bytes.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+            writeU32(bytes, 18);
+            writeU16(bytes, WAVE_FORMAT_IEEE_FLOAT);
+            writeU16(bytes, static_cast<std::uint16_t>(channels));
+            writeU32(bytes, static_cast<std::uint32_t>(sample_rate));
+            writeU32(bytes, static_cast<std::uint32_t>(sample_rate * channels * 4));
+            writeU16(bytes, static_cast<std::uint16_t>(channels * 4));
+            writeU16(bytes, 32);
+            writeU16(bytes, 0);
+            bytes.insert(bytes.end(), { 'f', 'a', 'c', 't' });
+            writeU32(bytes, 4);
+            writeU32(bytes, static_cast<std::uint32_t>(frames));
+            bytes.insert(bytes.end(), { 'd', 'a', 't', 'a' });
+            writeU32(bytes, data_bytes);
+        }
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+        for (long long chunk_start = 0; chunk_start < frames; chunk_start += WRITE_CHUNK_FRAMES) {
+            const int chunk_frames = static_cast<int>(std::min<long long>(WRITE_CHUNK_FRAMES, frames - chunk_start));
+            bytes.clear();
+            for (int frame = 0; frame < chunk_frames; ++frame) {
+                for (int ch = 0; ch < channels; ++ch) {
+                    writeU32(bytes, bitsFromFloat(block.getChannel(ch)[chunk_start + frame]));
+                }
+            }
+            file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        if (!file) {
+            error = "Failed writing " + path;
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Syntri
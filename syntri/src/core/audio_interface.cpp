@@ -10,203 +10,158 @@
 #include <algorithm>
 
 #include "syntri/audio_interface.h"
+#include "syntri/audio_kernels.h"
+#include "syntri/fixed_size_processor.h"
+#include "syntri/signal_generator.h"
+#include "syntri/stub_interface.h"
+#include "syntri/log.h"
 #include <iostream>
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <mutex>
 
 namespace Syntri {
 
+    namespace {
+        thread_local std::uint64_t callback_deadline_ticks = 0;
+    }
+
     // ====================================
-    // StubAudioInterface - Your Working Foundation (PRESERVED)
+    // AudioProcessor - Callback Bridging
     // ====================================
-    class StubAudioInterface : public AudioInterface {
-    private:
-        bool initialized_;
-        bool streaming_;
-        int sample_rate_;
-        int buffer_size_;
-        AudioProcessor* processor_;
-        std::chrono::high_resolution_clock::time_point last_callback_time_;
-        HardwareType hardware_type_;
-        int callback_count_;
-
-    public:
-        StubAudioInterface()
-            : initialized_(false), streaming_(false), sample_rate_(SAMPLE_RATE_96K),
-            buffer_size_(BUFFER_SIZE_ULTRA_LOW), processor_(nullptr),
-            hardware_type_(HardwareType::GENERIC_ASIO), callback_count_(0) {
-            std::cout << "Creating stub audio interface..." << std::endl;
-            last_callback_time_ = std::chrono::high_resolution_clock::now();
+    void AudioProcessor::processAudio(
+        const MultiChannelBuffer& inputs,
+        MultiChannelBuffer& outputs,
+        int num_samples
+    ) {
+        // Point stack tables at the vectors - no allocation on this path
+        const AudioSample* input_channels[MAX_AUDIO_CHANNELS];
+        AudioSample* output_channels[MAX_AUDIO_CHANNELS];
+
+        int frames = num_samples;
+        int num_inputs = std::min(static_cast<int>(inputs.size()), MAX_AUDIO_CHANNELS);
+        int num_outputs = std::min(static_cast<int>(outputs.size()), MAX_AUDIO_CHANNELS);
+
+        for (int ch = 0; ch < num_inputs; ++ch) {
+            input_channels[ch] = inputs[ch].data();
+            frames = std::min(frames, static_cast<int>(inputs[ch].size()));
         }
-
-        ~StubAudioInterface() {
-            std::cout << "Destroying stub audio interface..." << std::endl;
-            if (streaming_) {
-                stopStreaming();
-            }
-            if (initialized_) {
-                shutdown();
-            }
+        for (int ch = 0; ch < num_outputs; ++ch) {
+            output_channels[ch] = outputs[ch].data();
+            frames = std::min(frames, static_cast<int>(outputs[ch].size()));
         }
 
-        bool initialize(int sample_rate = SAMPLE_RATE_96K, int buffer_size = BUFFER_SIZE_ULTRA_LOW) override {
-            std::cout << "Initializing stub interface (SR: " << sample_rate
-                << " Hz, Buffer: " << buffer_size << ")" << std::endl;
+        processAudio(ConstAudioBlock(input_channels, num_inputs, std::max(frames, 0)),
+            AudioBlock(output_channels, num_outputs, std::max(frames, 0)));
+    }
 
-            sample_rate_ = sample_rate;
-            buffer_size_ = buffer_size;
-            initialized_ = true;
+    void AudioProcessor::processAudio(const ConstAudioBlock& /*inputs*/, const AudioBlock& outputs) {
+        clearBlock(outputs);
+    }
 
-            std::cout << "Stub interface initialized successfully" << std::endl;
-            return true;
-        }
+    void LegacyProcessorBridge::prepare(int num_input_channels, int num_output_channels, int max_frames) {
+        inputs_.assign(num_input_channels, AudioBuffer(max_frames, 0.0f));
+        outputs_.assign(num_output_channels, AudioBuffer(max_frames, 0.0f));
+    }
 
-        void shutdown() override {
-            if (!initialized_) return;
+    void LegacyProcessorBridge::process(AudioProcessor& processor, const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+        const int frames = outputs.getNumFrames();
 
-            std::cout << "Shutting down stub interface..." << std::endl;
-            if (streaming_) {
-                stopStreaming();
+        // Resizing within the prepared capacity never allocates
+        for (size_t ch = 0; ch < inputs_.size(); ++ch) {
+            auto& channel = inputs_[ch];
+            channel.resize(frames);
+            if (static_cast<int>(ch) < inputs.getNumChannels()) {
+                std::copy_n(inputs.getChannel(static_cast<int>(ch)), std::min(frames, inputs.getNumFrames()), channel.begin());
+            }
+            else {
+                std::fill(channel.begin(), channel.end(), 0.0f);
             }
-            initialized_ = false;
-            std::cout << "Stub interface shutdown complete" << std::endl;
-        }
-
-        bool isInitialized() const override {
-            return initialized_;
-        }
-
-        HardwareType getType() const override {
-            return hardware_type_;
-        }
-
-        std::string getName() const override {
-            return "Syntri Stub Interface";
-        }
-
-        int getInputChannelCount() const override {
-            return 8;  // Simulated 8-channel input
         }
-
-        int getOutputChannelCount() const override {
-            return 8;  // Simulated 8-channel output
+        for (auto& channel : outputs_) {
+            channel.resize(frames);
         }
 
-        double getCurrentLatency() const override {
-            // Calculate theoretical latency based on buffer size and sample rate
-            return (static_cast<double>(buffer_size_) / static_cast<double>(sample_rate_)) * 1000.0;
-        }
+        processor.processAudio(inputs_, outputs_, frames);
 
-        bool startStreaming(AudioProcessor* processor) override {
-            if (!initialized_ || !processor) {
-                std::cout << "Cannot start streaming - not initialized or no processor" << std::endl;
-                return false;
+        for (int ch = 0; ch < outputs.getNumChannels(); ++ch) {
+            if (ch < static_cast<int>(outputs_.size()) && static_cast<int>(outputs_[ch].size()) >= frames) {
+                std::copy_n(outputs_[ch].begin(), frames, outputs.getChannel(ch));
+            }
+            else {
+                std::fill_n(outputs.getChannel(ch), frames, 0.0f);
             }
-
-            processor_ = processor;
-            std::cout << "Starting stub streaming..." << std::endl;
-
-            // Notify processor of setup
-            processor_->setupChanged(sample_rate_, buffer_size_);
-
-            streaming_ = true;
-            std::cout << "Stub streaming started successfully" << std::endl;
-
-            return true;
         }
+    }
 
-        void stopStreaming() override {
-            if (!streaming_) return;
+    std::uint64_t getCallbackDeadlineTicks() {
+        return callback_deadline_ticks;
+    }
 
-            std::cout << "Stopping stub streaming..." << std::endl;
-            streaming_ = false;
-            processor_ = nullptr;
-            std::cout << "Stub streaming stopped" << std::endl;
-        }
+    CallbackDeadlineScope::CallbackDeadlineScope(std::uint64_t deadline_ticks)
+        : previous_(callback_deadline_ticks) {
+        callback_deadline_ticks = deadline_ticks;
+    }
 
-        bool isStreaming() const override {
-            return streaming_;
-        }
+    CallbackDeadlineScope::~CallbackDeadlineScope() {
+        callback_deadline_ticks = previous_;
+    }
 
-        SimpleMetrics getMetrics() const override {
-            SimpleMetrics metrics;
-            metrics.latency_ms = getCurrentLatency();
-            metrics.cpu_usage_percent = 5.0 + (callback_count_ % 10) * 0.5; // Simulated CPU usage
-            metrics.buffer_underruns = 0; // Stub never has underruns
-            return metrics;
+    // ====================================
+    // AudioInterface - Defaults
+    // ====================================
+    bool AudioInterface::reconfigure(int sample_rate, int buffer_size) {
+        if (isStreaming()) {
+            SYNTRI_LOG_WARNING("%s cannot reconfigure while streaming", getName().c_str());
+            return false;
         }
-    };
+        shutdown();
+        return initialize(sample_rate, buffer_size);
+    }
 
     // ====================================
     // TestAudioProcessor - Internal Implementation
     // ====================================
-    class TestAudioProcessor : public AudioProcessor {
+    class TestAudioProcessor : public FixedSizeProcessor<TestAudioProcessor> {
     private:
         bool generate_tone_;
-        double phase_;
-        double frequency_;
-        int sample_rate_;
+        SignalGenerator tone_;     // 440 Hz sine at -20 dBFS
 
     public:
         TestAudioProcessor(bool generate_tone = false)
-            : generate_tone_(generate_tone), phase_(0.0), frequency_(440.0), sample_rate_(SAMPLE_RATE_96K) {
-            std::cout << "Creating test audio processor (tone: " << (generate_tone ? "ON" : "OFF") << ")" << std::endl;
+            : generate_tone_(generate_tone) {
+            SYNTRI_LOG_VERBOSE("Creating test audio processor (tone: %s)", generate_tone ? "ON" : "OFF");
         }
 
-        void processAudio(
-            const MultiChannelBuffer& inputs,
-            MultiChannelBuffer& outputs,
-            int num_samples
-        ) override {
-            // Ensure outputs are properly sized
-            for (auto& channel : outputs) {
-                if (channel.size() != static_cast<size_t>(num_samples)) {
-                    channel.resize(num_samples, 0.0f);
-                }
+        // Deployed shapes: channel and frame counts are constants
+        template <int Channels, int Frames>
+        void processFixed(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+            if (generate_tone_) {
+                tone_.render(outputs);
+                return;
             }
+            for (int ch = 0; ch < Channels; ++ch) {
+                const AudioSample* input = inputs.getChannel(ch);
+                AudioSample* output = outputs.getChannel(ch);
+                if (input != output) std::copy_n(input, Frames, output);
+            }
+        }
 
+        void processDynamic(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
             if (generate_tone_) {
-                // Generate test tone using M_PI (now properly defined)
-                double phase_increment = 2.0 * M_PI * frequency_ / sample_rate_;
-
-                for (int sample = 0; sample < num_samples; ++sample) {
-                    float tone_sample = static_cast<float>(0.1 * std::sin(phase_));
-                    phase_ += phase_increment;
-
-                    // Apply to all output channels
-                    for (auto& channel : outputs) {
-                        if (sample < static_cast<int>(channel.size())) {
-                            channel[sample] = tone_sample;
-                        }
-                    }
-                }
-
-                // Keep phase in range
-                while (phase_ >= 2.0 * M_PI) {
-                    phase_ -= 2.0 * M_PI;
-                }
+                // Same tone on every output channel
+                tone_.render(outputs);
             }
             else {
                 // Pass through inputs to outputs (or silence if no inputs)
-                for (size_t ch = 0; ch < outputs.size(); ++ch) {
-                    for (int sample = 0; sample < num_samples; ++sample) {
-                        if (sample < static_cast<int>(outputs[ch].size())) {
-                            if (ch < inputs.size() && sample < static_cast<int>(inputs[ch].size())) {
-                                outputs[ch][sample] = inputs[ch][sample];
-                            }
-                            else {
-                                outputs[ch][sample] = 0.0f;
-                            }
-                        }
-                    }
-                }
+                copyBlock(inputs, outputs);
             }
         }
 
         void setupChanged(int sample_rate, int buffer_size) override {
-            sample_rate_ = sample_rate;
-            std::cout << "Test processor setup changed (SR: " << sample_rate
-                << " Hz, Buffer: " << buffer_size << ")" << std::endl;
+            tone_.setSampleRate(sample_rate);
+            SYNTRI_LOG_VERBOSE("Test processor setup changed (SR: %d Hz, Buffer: %d)", sample_rate, buffer_size);
         }
     };
 
@@ -214,16 +169,16 @@ namespace Syntri {
     // Factory Functions - Simplified and Working
     // ====================================
     std::unique_ptr<AudioInterface> createAudioInterface(HardwareType type) {
-        std::cout << "Creating audio interface for: " << hardwareTypeToString(type) << std::endl;
+        SYNTRI_LOG_INFO("Creating audio interface for: %s", hardwareTypeToString(type).c_str());
 
         // For now, always return stub interface
         // TODO: Add ASIO integration when properly implemented
-        std::cout << "Using stub interface (ASIO integration pending)" << std::endl;
+        SYNTRI_LOG_INFO("Using stub interface (ASIO integration pending)");
         return std::make_unique<StubAudioInterface>();
     }
 
     std::unique_ptr<AudioInterface> createStubInterface() {
-        std::cout << "Creating stub interface directly" << std::endl;
+        SYNTRI_LOG_VERBOSE("Creating stub interface directly");
         return std::make_unique<StubAudioInterface>();
     }
 
@@ -237,16 +192,16 @@ namespace Syntri {
     std::vector<HardwareType> detectAvailableHardware() {
         std::vector<HardwareType> detected;
 
-        std::cout << "Detecting available audio hardware..." << std::endl;
+        SYNTRI_LOG_INFO("Detecting available audio hardware...");
 
         // For now, just return generic interface
         // TODO: Add real ASIO detection when properly implemented
         detected.push_back(HardwareType::GENERIC_ASIO);
-        std::cout << "Generic interface available" << std::endl;
+        SYNTRI_LOG_VERBOSE("Generic interface available");
 
-        std::cout << "Detection complete. Found " << detected.size() << " interface(s):" << std::endl;
+        SYNTRI_LOG_INFO("Detection complete. Found %zu interface(s):", detected.size());
         for (const auto& hw : detected) {
-            std::cout << "   - " << hardwareTypeToString(hw) << std::endl;
+            SYNTRI_LOG_INFO("   - %s", hardwareTypeToString(hw).c_str());
         }
 
         return detected;
@@ -0,0 +1,187 @@
+// src/core/audio_kernels.cpp
+// Runtime CPU dispatch for the sample kernels, plus the portable scalar path
+
+#include "syntri/audio_kernels.h"
+#include "audio_kernels_impl.h"
+#include <atomic>
+
+#if defined(SYNTRI_KERNELS_X86) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace Syntri {
+namespace Kernels {
+
+    namespace {
+        struct Scalar {
+            using Vec = float;
+            static constexpr int WIDTH = 1;
+
+            static Vec load(const float* p) { return *p; }
+            static void store(float* p, Vec v) { *p = v; }
+            static Vec set1(float x) { return x; }
+            static Vec zero() { return 0.0f; }
+            static Vec add(Vec a, Vec b) { return a + b; }
+            static Vec mul(Vec a, Vec b) { return a * b; }
+            static Vec fmadd(Vec a, Vec b, Vec c) { return a * b + c; }
+            static Vec ramp(float start, float /*step*/) { return start; }
+        };
+
+        constexpr KernelTable scalar_table = KernelBodies<Scalar>::table();
+
+        std::atomic<const KernelTable*> active_table(nullptr);
+        std::atomic<InstructionSet> active_isa(InstructionSet::SCALAR);
+
+#if defined(SYNTRI_KERNELS_X86)
+        bool cpuSupports(InstructionSet isa) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            int max_leaf = info[0];
+
+            __cpuid(info, 1);
+            bool has_sse2 = (info[3] & (1 << 26)) != 0;
+            bool has_fma = (info[2] & (1 << 12)) != 0;
+            bool has_osxsave = (info[2] & (1 << 27)) != 0;
+            unsigned long long xcr0 = has_osxsave ? _xgetbv(0) : 0;
+            bool os_ymm = (xcr0 & 0x6) == 0x6;
+            bool os_zmm = (xcr0 & 0xE6) == 0xE6;
+
+            bool has_avx2 = false;
+            bool has_avx512f = false;
+            if (max_leaf >= 7) {
+                __cpuidex(info, 7, 0);
+                has_avx2 = (info[1] & (1 << 5)) != 0;
+                has_avx512f = (info[1] & (1 << 16)) != 0;
+            }
+
+            switch (isa) {
+            case InstructionSet::SSE2: return has_sse2;
+            case InstructionSet::AVX2: return has_avx2 && has_fma && os_ymm;
+            case InstructionSet::AVX512: return has_avx512f && os_zmm;
+            default: return true;
+            }
+#else
+            __builtin_cpu_init();
+            switch (isa) {
+            case InstructionSet::SSE2: return __builtin_cpu_supports("sse2");
+            case InstructionSet::AVX2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            case InstructionSet::AVX512: return __builtin_cpu_supports("avx512f");
+            default: return true;
+            }
+#endif
+        }
+#endif
+
+        const KernelTable* tableFor(InstructionSet isa) {
+            switch (isa) {
+#if defined(SYNTRI_KERNELS_X86)
+            case InstructionSet::SSE2: return &getSse2Kernels();
+            case InstructionSet::AVX2: return &getAvx2Kernels();
+            case InstructionSet::AVX512: return &getAvx512Kernels();
+#endif
+            case InstructionSet::SCALAR: return &scalar_table;
+            default: return nullptr;
+            }
+        }
+
+        bool isSupported(InstructionSet isa) {
+            if (isa == InstructionSet::SCALAR) return true;
+#if defined(SYNTRI_KERNELS_X86)
+            return cpuSupports(isa);
+#else
+            return false;
+#endif
+        }
+
+        const KernelTable& kernels() {
+            const KernelTable* table = active_table.load(std::memory_order_acquire);
+            if (!table) {
+                InstructionSet isa = detectInstructionSet();
+                table = tableFor(isa);
+                active_isa.store(isa, std::memory_order_relaxed);
+                active_table.store(table, std::memory_order_release);
+            }
+            return *table;
+        }
+    }
+
+    std::string instructionSetToString(InstructionSet isa) {
+        switch (isa) {
+        case InstructionSet::SCALAR: return "Scalar";
+        case InstructionSet::SSE2: return "SSE2";
+        case InstructionSet::AVX2: return "AVX2";
+        case InstructionSet::AVX512: return "AVX-512";
+        default: return "Unknown";
+        }
+    }
+
+    InstructionSet detectInstructionSet() {
+        if (isSupported(InstructionSet::AVX512)) return InstructionSet::AVX512;
+        if (isSupported(InstructionSet::AVX2)) return InstructionSet::AVX2;
+        if (isSupported(InstructionSet::SSE2)) return InstructionSet::SSE2;
+        return InstructionSet::SCALAR;
+    }
+
+    InstructionSet getActiveInstructionSet() {
+        kernels();
+        return active_isa.load(std::memory_order_relaxed);
+    }
+
+    bool setActiveInstructionSet(InstructionSet isa) {
+        if (!isSupported(isa)) {
+            return false;
+        }
+        active_isa.store(isa, std::memory_order_relaxed);
+        active_table.store(tableFor(isa), std::memory_order_release);
+        return true;
+    }
+
+    // ====================================
+    // Dispatching entry points
+    // ====================================
+    void copy(const AudioSample* source, AudioSample* destination, int num_samples) {
+        kernels().copy(source, destination, num_samples);
+    }
+
+    void clear(AudioSample* destination, int num_samples) {
+        kernels().clear(destination, num_samples);
+    }
+
+    void copyWithGain(const AudioSample* source, AudioSample* destination, int num_samples, float gain) {
+        kernels().copyWithGain(source, destination, num_samples, gain);
+    }
+
+    void applyGain(AudioSample* buffer, int num_samples, float gain) {
+        kernels().applyGain(buffer, num_samples, gain);
+    }
+
+    void applyGainRamp(AudioSample* buffer, int num_samples, float start_gain, float end_gain) {
+        kernels().applyGainRamp(buffer, num_samples, start_gain, end_gain);
+    }
+
+    void mixAccumulate(const AudioSample* source, AudioSample* bus, int num_samples, float gain) {
+        kernels().mixAccumulate(source, bus, num_samples, gain);
+    }
+
+    void mixAccumulateRamp(const AudioSample* source, AudioSample* bus, int num_samples,
+        float start_gain, float end_gain) {
+        kernels().mixAccumulateRamp(source, bus, num_samples, start_gain, end_gain);
+    }
+
+    void panAccumulate(const AudioSample* source, AudioSample* left, AudioSample* right, int num_samples,
+        float left_gain, float right_gain) {
+        kernels().panAccumulate(source, left, right, num_samples, left_gain, right_gain);
+    }
+
+    void panAccumulateRamp(const AudioSample* source, AudioSample* left, AudioSample* right, int num_samples,
+        float left_start, float left_end, float right_start, float right_end) {
+        kernels().panAccumulateRamp(source, left, right, num_samples, left_start, left_end, right_start, right_end);
+    }
+
+    const KernelTable& getScalarKernels() {
+        return scalar_table;
+    }
+
+} // namespace Kernels
+} // namespace Syntri
@@ -0,0 +1,36 @@
+// src/core/audio_kernels_avx2.cpp
+// AVX2 + FMA kernel path - this file is built with AVX2/FMA code generation
+
+#include "audio_kernels_impl.h"
+#include <immintrin.h>
+
+namespace Syntri {
+namespace Kernels {
+
+    namespace {
+        struct Avx2 {
+            using Vec = __m256;
+            static constexpr int WIDTH = 8;
+
+            static Vec load(const float* p) { return _mm256_loadu_ps(p); }
+            static void store(float* p, Vec v) { _mm256_storeu_ps(p, v); }
+            static Vec set1(float x) { return _mm256_set1_ps(x); }
+            static Vec zero() { return _mm256_setzero_ps(); }
+            static Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+            static Vec mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+            static Vec fmadd(Vec a, Vec b, Vec c) { return _mm256_fmadd_ps(a, b, c); }
+            static Vec ramp(float start, float step) {
+                return _mm256_fmadd_ps(_mm256_set1_ps(step), _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7),
+                    _mm256_set1_ps(start));
+            }
+        };
+
+        constexpr KernelTable avx2_table = KernelBodies<Avx2>::table();
+    }
+
+    const KernelTable& getAvx2Kernels() {
+        return avx2_table;
+    }
+
+} // namespace Kernels
+} // namespace Syntri
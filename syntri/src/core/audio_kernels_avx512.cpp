@@ -0,0 +1,37 @@
+// src/core/audio_kernels_avx512.cpp
+// AVX-512F kernel path - this file is built with AVX-512F code generation
+
+#include "audio_kernels_impl.h"
+#include <immintrin.h>
+
+namespace Syntri {
+namespace Kernels {
+
+    namespace {
+        struct Avx512 {
+            using Vec = __m512;
+            static constexpr int WIDTH = 16;
+
+            static Vec load(const float* p) { return _mm512_loadu_ps(p); }
+            static void store(float* p, Vec v) { _mm512_storeu_ps(p, v); }
+            static Vec set1(float x) { return _mm512_set1_ps(x); }
+            static Vec zero() { return _mm512_setzero_ps(); }
+            static Vec add(Vec a, Vec b) { return _mm512_add_ps(a, b); }
+            static Vec mul(Vec a, Vec b) { return _mm512_mul_ps(a, b); }
+            static Vec fmadd(Vec a, Vec b, Vec c) { return _mm512_fmadd_ps(a, b, c); }
+            static Vec ramp(float start, float step) {
+                return _mm512_fmadd_ps(_mm512_set1_ps(step),
+                    _mm512_setr_ps(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                    _mm512_set1_ps(start));
+            }
+        };
+
+        constexpr KernelTable avx512_table = KernelBodies<Avx512>::table();
+    }
+
+    const KernelTable& getAvx512Kernels() {
+        return avx512_table;
+    }
+
+} // namespace Kernels
+} // namespace Syntri
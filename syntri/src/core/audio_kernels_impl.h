@@ -0,0 +1,154 @@
+// src/core/audio_kernels_impl.h
+// Internal: kernel dispatch table and the ISA-generic loop bodies.
+//
+// Each audio_kernels_<isa>.cpp defines its traits struct in an anonymous
+// namespace and instantiates KernelBodies with it. The instantiations then
+// have internal linkage, so code built with wider ISA flags can never be
+// picked by the linker for another path.
+#pragma once
+
+namespace Syntri {
+namespace Kernels {
+
+    struct KernelTable {
+        void (*copy)(const float*, float*, int);
+        void (*clear)(float*, int);
+        void (*copyWithGain)(const float*, float*, int, float);
+        void (*applyGain)(float*, int, float);
+        void (*applyGainRamp)(float*, int, float, float);
+        void (*mixAccumulate)(const float*, float*, int, float);
+        void (*mixAccumulateRamp)(const float*, float*, int, float, float);
+        void (*panAccumulate)(const float*, float*, float*, int, float, float);
+        void (*panAccumulateRamp)(const float*, float*, float*, int, float, float, float, float);
+    };
+
+    const KernelTable& getScalarKernels();
+#if defined(SYNTRI_KERNELS_X86)
+    const KernelTable& getSse2Kernels();
+    const KernelTable& getAvx2Kernels();
+    const KernelTable& getAvx512Kernels();
+#endif
+
+    // V provides: Vec, WIDTH, load, store, set1, zero, add, mul,
+    // fmadd(a, b, c) = a * b + c, and ramp(start, step) = start + step * lane.
+    // Only intrinsics are used here - no std:: helpers that could be shared
+    // across translation units built with different flags.
+    template <typename V>
+    struct KernelBodies {
+        using Vec = typename V::Vec;
+        static constexpr int W = V::WIDTH;
+
+        static void copy(const float* source, float* destination, int n) {
+            int i = 0;
+            for (; i + 2 * W <= n; i += 2 * W) {
+                V::store(destination + i, V::load(source + i));
+                V::store(destination + i + W, V::load(source + i + W));
+            }
+            for (; i + W <= n; i += W) V::store(destination + i, V::load(source + i));
+            for (; i < n; ++i) destination[i] = source[i];
+        }
+
+        static void clear(float* destination, int n) {
+            const Vec zero = V::zero();
+            int i = 0;
+            for (; i + W <= n; i += W) V::store(destination + i, zero);
+            for (; i < n; ++i) destination[i] = 0.0f;
+        }
+
+        static void copyWithGain(const float* source, float* destination, int n, float gain) {
+            const Vec g = V::set1(gain);
+            int i = 0;
+            for (; i + W <= n; i += W) V::store(destination + i, V::mul(V::load(source + i), g));
+            for (; i < n; ++i) destination[i] = source[i] * gain;
+        }
+
+        static void applyGain(float* buffer, int n, float gain) {
+            copyWithGain(buffer, buffer, n, gain);
+        }
+
+        static void applyGainRamp(float* buffer, int n, float start, float end) {
+            if (n <= 0) return;
+            const float step = (end - start) / static_cast<float>(n);
+            Vec g = V::ramp(start, step);
+            const Vec g_step = V::set1(step * W);
+            int i = 0;
+            for (; i + W <= n; i += W) {
+                V::store(buffer + i, V::mul(V::load(buffer + i), g));
+                g = V::add(g, g_step);
+            }
+            for (; i < n; ++i) buffer[i] *= start + step * static_cast<float>(i);
+        }
+
+        static void mixAccumulate(const float* source, float* bus, int n, float gain) {
+            const Vec g = V::set1(gain);
+            int i = 0;
+            for (; i + 2 * W <= n; i += 2 * W) {
+                V::store(bus + i, V::fmadd(V::load(source + i), g, V::load(bus + i)));
+                V::store(bus + i + W, V::fmadd(V::load(source + i + W), g, V::load(bus + i + W)));
+            }
+            for (; i + W <= n; i += W) V::store(bus + i, V::fmadd(V::load(source + i), g, V::load(bus + i)));
+            for (; i < n; ++i) bus[i] += source[i] * gain;
+        }
+
+        static void mixAccumulateRamp(const float* source, float* bus, int n, float start, float end) {
+            if (n <= 0) return;
+            const float step = (end - start) / static_cast<float>(n);
+            Vec g = V::ramp(start, step);
+            const Vec g_step = V::set1(step * W);
+            int i = 0;
+            for (; i + W <= n; i += W) {
+                V::store(bus + i, V::fmadd(V::load(source + i), g, V::load(bus + i)));
+                g = V::add(g, g_step);
+            }
+            for (; i < n; ++i) bus[i] += source[i] * (start + step * static_cast<float>(i));
+        }
+
+        static void panAccumulate(const float* source, float* left, float* right, int n,
+            float left_gain, float right_gain) {
+            const Vec gl = V::set1(left_gain);
+            const Vec gr = V::set1(right_gain);
+            int i = 0;
+            for (; i + W <= n; i += W) {
+                const Vec s = V::load(source + i);
+                V::store(left + i, V::fmadd(s, gl, V::load(left + i)));
+                V::store(right + i, V::fmadd(s, gr, V::load(right + i)));
+            }
+            for (; i < n; ++i) {
+                left[i] += source[i] * left_gain;
+                right[i] += source[i] * right_gain;
+            }
+        }
+
+        static void panAccumulateRamp(const float* source, float* left, float* right, int n,
+            float left_start, float left_end, float right_start, float right_end) {
+            if (n <= 0) return;
+            const float left_step = (left_end - left_start) / static_cast<float>(n);
+            const float right_step = (right_end - right_start) / static_cast<float>(n);
+            Vec gl = V::ramp(left_start, left_step);
+            Vec gr = V::ramp(right_start, right_step);
+            const Vec gl_step = V::set1(left_step * W);
+            const Vec gr_step = V::set1(right_step * W);
+            int i = 0;
+            for (; i + W <= n; i += W) {
+                const Vec s = V::load(source + i);
+                V::store(left + i, V::fmadd(s, gl, V::load(left + i)));
+                V::store(right + i, V::fmadd(s, gr, V::load(right + i)));
+                gl = V::add(gl, gl_step);
+                gr = V::add(gr, gr_step);
+            }
+            for (; i < n; ++i) {
+                left[i] += source[i] * (left_start + left_step * static_cast<float>(i));
+                right[i] += source[i] * (right_start + right_step * static_cast<float>(i));
+            }
+        }
+
+        static constexpr KernelTable table() {
+            return KernelTable{
+                copy, clear, copyWithGain, applyGain, applyGainRamp,
+                mixAccumulate, mixAccumulateRamp, panAccumulate, panAccumulateRamp
+            };
+        }
+    };
+
+} // namespace Kernels
+} // namespace Syntri
@@ -0,0 +1,35 @@
+// src/core/audio_kernels_sse2.cpp
+// SSE2 kernel path (x86-64 baseline)
+
+#include "audio_kernels_impl.h"
+#include <emmintrin.h>
+
+namespace Syntri {
+namespace Kernels {
+
+    namespace {
+        struct Sse2 {
+            using Vec = __m128;
+            static constexpr int WIDTH = 4;
+
+            static Vec load(const float* p) { return _mm_loadu_ps(p); }
+            static void store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+            static Vec set1(float x) { return _mm_set1_ps(x); }
+            static Vec zero() { return _mm_setzero_ps(); }
+            static Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+            static Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+            static Vec fmadd(Vec a, Vec b, Vec c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+            static Vec ramp(float start, float step) {
+                return _mm_add_ps(_mm_set1_ps(start), _mm_mul_ps(_mm_set1_ps(step), _mm_setr_ps(0, 1, 2, 3)));
+            }
+        };
+
+        constexpr KernelTable sse2_table = KernelBodies<Sse2>::table();
+    }
+
+    const KernelTable& getSse2Kernels() {
+        return sse2_table;
+    }
+
+} // namespace Kernels
+} // namespace Syntri
@@ -0,0 +1,180 @@
+// src/core/clock.cpp
+// TSC detection, calibration against CLOCK_MONOTONIC_RAW and fixed-point conversion
+
+#include "syntri/clock.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <time.h>
+#define SYNTRI_CLOCK_HAS_MONOTONIC_RAW 1
+#endif
+
+#if defined(SYNTRI_CLOCK_HAS_TSC) && !defined(_MSC_VER)
+#include <cpuid.h>
+#endif
+
+namespace Syntri {
+
+    namespace detail {
+        std::atomic<int> clock_mode{ CLOCK_MODE_UNCALIBRATED };
+    }
+
+    namespace {
+        constexpr int CONVERSION_SHIFT = 32;
+        constexpr int CALIBRATION_MS = 10;
+        constexpr int CALIBRATION_PAIRS = 5;
+        constexpr double MIN_TSC_HZ = 1.0e8;
+        constexpr double MAX_TSC_HZ = 1.0e10;
+
+        ClockInfo clock_info;
+        std::once_flag calibration_once;
+
+        // ns = (ticks * ticks_to_ns) >> CONVERSION_SHIFT, and the reverse
+        std::uint64_t ticks_to_ns = 1ULL << CONVERSION_SHIFT;
+        std::uint64_t ns_to_ticks = 1ULL << CONVERSION_SHIFT;
+
+        // One simultaneous reading of both clocks, for the timestamp epoch
+        std::uint64_t epoch_ticks = 0;
+        std::uint64_t epoch_ns = 0;
+
+        std::uint64_t multiplyShift(std::uint64_t value, std::uint64_t multiplier) {
+#if defined(__SIZEOF_INT128__)
+            return static_cast<std::uint64_t>((static_cast<unsigned __int128>(value) * multiplier) >> CONVERSION_SHIFT);
+#else
+            return static_cast<std::uint64_t>(static_cast<long double>(value) * multiplier / 4294967296.0L);
+#endif
+        }
+
+        std::uint64_t readReferenceNanoseconds() {
+#if defined(SYNTRI_CLOCK_HAS_MONOTONIC_RAW)
+            timespec now;
+            clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+            return static_cast<std::uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<std::uint64_t>(now.tv_nsec);
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+#if defined(SYNTRI_CLOCK_HAS_TSC)
+        // CPUID.80000007H:EDX[8] - the TSC ticks at a constant rate in every
+        // P- and C-state and does not stop in deep sleep
+        bool hasInvariantTsc() {
+            unsigned int registers[4] = { 0, 0, 0, 0 };
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0x80000000);
+            if (static_cast<unsigned int>(info[0]) < 0x80000007u) return false;
+            __cpuid(info, 0x80000007);
+            registers[3] = static_cast<unsigned int>(info[3]);
+#else
+            if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) return false;
+            __get_cpuid(0x80000007u, &registers[0], &registers[1], &registers[2], &registers[3]);
+#endif
+            return (registers[3] & (1u << 8)) != 0;
+        }
+
+        // Reference time and TSC taken as close together as we can manage:
+        // keep the pair whose bracketing reads are nearest
+        void readClockPair(std::uint64_t& ticks, std::uint64_t& nanoseconds) {
+            std::uint64_t best_window = ~0ULL;
+            for (int attempt = 0; attempt < CALIBRATION_PAIRS; ++attempt) {
+                const std::uint64_t before = readReferenceNanoseconds();
+                const std::uint64_t tsc = __rdtsc();
+                const std::uint64_t after = readReferenceNanoseconds();
+                if (after - before < best_window) {
+                    best_window = after - before;
+                    ticks = tsc;
+                    nanoseconds = before + (after - before) / 2;
+                }
+            }
+        }
+#endif
+
+        void calibrate() {
+            int mode = detail::CLOCK_MODE_FALLBACK;
+#if defined(SYNTRI_CLOCK_HAS_MONOTONIC_RAW)
+            clock_info.source = ClockSource::MONOTONIC_RAW;
+#else
+            clock_info.source = ClockSource::STEADY_CLOCK;
+#endif
+            clock_info.ticks_per_second = 1.0e9;
+
+#if defined(SYNTRI_CLOCK_HAS_TSC)
+            if (hasInvariantTsc()) {
+                std::uint64_t start_ticks = 0, start_ns = 0, end_ticks = 0, end_ns = 0;
+                readClockPair(start_ticks, start_ns);
+                std::this_thread::sleep_for(std::chrono::milliseconds(CALIBRATION_MS));
+                readClockPair(end_ticks, end_ns);
+
+                const double hz = end_ns > start_ns && end_ticks > start_ticks
+                    ? static_cast<double>(end_ticks - start_ticks) * 1.0e9 / static_cast<double>(end_ns - start_ns)
+                    : 0.0;
+                if (hz >= MIN_TSC_HZ && hz <= MAX_TSC_HZ) {
+                    clock_info.source = ClockSource::TSC;
+                    clock_info.ticks_per_second = hz;
+                    ticks_to_ns = static_cast<std::uint64_t>(1.0e9 / hz * 4294967296.0 + 0.5);
+                    ns_to_ticks = static_cast<std::uint64_t>(hz / 1.0e9 * 4294967296.0 + 0.5);
+                    epoch_ticks = end_ticks;
+                    epoch_ns = end_ns;
+                    mode = detail::CLOCK_MODE_TSC;
+                }
+            }
+#endif
+            detail::clock_mode.store(mode, std::memory_order_release);
+        }
+
+        // Calibrate during static initialization so the audio thread never pays for it
+        const bool calibrated_at_startup = (calibrateClock(), true);
+    }
+
+    const char* clockSourceName(ClockSource source) {
+        switch (source) {
+        case ClockSource::TSC: return "TSC";
+        case ClockSource::MONOTONIC_RAW: return "CLOCK_MONOTONIC_RAW";
+        case ClockSource::STEADY_CLOCK: return "steady_clock";
+        }
+        return "unknown";
+    }
+
+    const ClockInfo& calibrateClock() {
+        (void)calibrated_at_startup;
+        std::call_once(calibration_once, calibrate);
+        return clock_info;
+    }
+
+    std::uint64_t detail::readClockTicksSlow() {
+        if (clock_mode.load(std::memory_order_acquire) == CLOCK_MODE_UNCALIBRATED) {
+            calibrateClock();
+        }
+#if defined(SYNTRI_CLOCK_HAS_TSC)
+        if (clock_mode.load(std::memory_order_relaxed) == CLOCK_MODE_TSC) {
+            return __rdtsc();
+        }
+#endif
+        return readReferenceNanoseconds();
+    }
+
+    // ====================================
+    // Conversion
+    // ====================================
+    std::uint64_t clockTicksToNanoseconds(std::uint64_t ticks) {
+        return multiplyShift(ticks, ticks_to_ns);
+    }
+
+    std::uint64_t nanosecondsToClockTicks(std::uint64_t nanoseconds) {
+        return multiplyShift(nanoseconds, ns_to_ticks);
+    }
+
+    std::uint64_t clockTimestampToNanoseconds(std::uint64_t ticks) {
+        if (detail::clock_mode.load(std::memory_order_acquire) != detail::CLOCK_MODE_TSC) {
+            return ticks;   // Fallback ticks are already nanoseconds
+        }
+        return ticks >= epoch_ticks
+            ? epoch_ns + clockTicksToNanoseconds(ticks - epoch_ticks)
+            : epoch_ns - clockTicksToNanoseconds(epoch_ticks - ticks);
+    }
+
+} // namespace Syntri
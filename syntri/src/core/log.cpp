@@ -0,0 +1,229 @@
+// src/core/log.cpp
+// Asynchronous logger - rings, drain thread and console sink
+
+#include "syntri/log.h"
+#include "syntri/clock.h"
+#include "syntri/command_queue.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Syntri {
+
+    namespace {
+        std::atomic<int> log_level{ static_cast<int>(LogLevel::INFO) };
+        std::atomic<long long> dropped_messages{ 0 };
+
+        enum RingState { RING_FREE = 0, RING_OWNED = 1, RING_RETIRED = 2 };
+
+        void consoleSink(const LogRecord& record) {
+            switch (record.level) {
+            case LogLevel::WARNING: std::cout << "Warning: "; break;
+            case LogLevel::SEVERE: std::cout << "Error: "; break;
+            default: break;
+            }
+            std::cout << record.text << '\n';
+        }
+
+        class LogBackend {
+        private:
+            struct Ring {
+                std::atomic<int> state{ RING_FREE };
+                SpscQueue<LogRecord> queue{ LOG_QUEUE_CAPACITY };
+            };
+
+            std::unique_ptr<Ring[]> rings_;
+
+            // Held while draining; serializes the drain thread, flushLog() and sink changes
+            std::mutex drain_mutex_;
+            LogSink sink_;
+            std::vector<LogRecord> batch_;
+
+            std::mutex stop_mutex_;
+            std::condition_variable stop_condition_;
+            bool stopping_;
+            std::thread drain_thread_;
+
+            // Caller holds drain_mutex_
+            void drainLocked() {
+                batch_.clear();
+                for (int index = 0; index < LOG_MAX_THREADS; ++index) {
+                    Ring& ring = rings_[index];
+                    const int state = ring.state.load(std::memory_order_acquire);
+                    if (state == RING_FREE) continue;
+
+                    LogRecord record;
+                    while (ring.queue.pop(record)) {
+                        record.timestamp_ns = clockTimestampToNanoseconds(record.timestamp_ns);    // Raw ticks until here
+                        batch_.push_back(record);
+                    }
+                    // The owner has exited and nothing is left - hand the ring back
+                    if (state == RING_RETIRED) {
+                        ring.state.store(RING_FREE, std::memory_order_release);
+                    }
+                }
+                if (batch_.empty()) return;
+
+                // Interleave threads in the order the messages were written
+                std::stable_sort(batch_.begin(), batch_.end(), [](const LogRecord& a, const LogRecord& b) {
+                    return a.timestamp_ns < b.timestamp_ns;
+                });
+                for (const LogRecord& record : batch_) {
+                    if (sink_) sink_(record);
+                    else consoleSink(record);
+                }
+                if (!sink_) std::cout.flush();
+            }
+
+            void drainThreadMain() {
+                std::unique_lock<std::mutex> stop_lock(stop_mutex_);
+                while (!stopping_) {
+                    stop_condition_.wait_for(stop_lock, std::chrono::milliseconds(LOG_DRAIN_INTERVAL_MS));
+                    std::lock_guard<std::mutex> lock(drain_mutex_);
+                    drainLocked();
+                }
+            }
+
+        public:
+            LogBackend() : rings_(new Ring[LOG_MAX_THREADS]), stopping_(false) {
+                batch_.reserve(static_cast<size_t>(LOG_MAX_THREADS) * LOG_QUEUE_CAPACITY);
+                drain_thread_ = std::thread(&LogBackend::drainThreadMain, this);
+            }
+
+            ~LogBackend() {
+                {
+                    std::lock_guard<std::mutex> lock(stop_mutex_);
+                    stopping_ = true;
+                }
+                stop_condition_.notify_all();
+                drain_thread_.join();
+                flush();
+            }
+
+            static LogBackend& instance() {
+                static LogBackend backend;
+                return backend;
+            }
+
+            int claimRing() {
+                for (int index = 0; index < LOG_MAX_THREADS; ++index) {
+                    int expected = RING_FREE;
+                    if (rings_[index].state.compare_exchange_strong(expected, RING_OWNED, std::memory_order_acq_rel)) {
+                        return index;
+                    }
+                }
+                return -1;
+            }
+
+            void releaseRing(int index) {
+                rings_[index].state.store(RING_RETIRED, std::memory_order_release);
+            }
+
+            bool push(int index, const LogRecord& record) {
+                return rings_[index].queue.push(record);
+            }
+
+            void setSink(LogSink sink) {
+                std::lock_guard<std::mutex> lock(drain_mutex_);
+                drainLocked();
+                sink_ = std::move(sink);
+            }
+
+            void flush() {
+                std::lock_guard<std::mutex> lock(drain_mutex_);
+                drainLocked();
+            }
+        };
+
+        // The calling thread's ring, returned to the pool when the thread exits
+        struct ThreadRing {
+            int index = -1;
+            bool claimed = false;
+
+            int get() {
+                if (!claimed) {
+                    claimed = true;
+                    index = LogBackend::instance().claimRing();
+                }
+                return index;
+            }
+
+            ~ThreadRing() {
+                if (index >= 0) {
+                    LogBackend::instance().releaseRing(index);
+                }
+            }
+        };
+
+        thread_local ThreadRing thread_ring;
+    }
+
+    // ====================================
+    // Levels
+    // ====================================
+    void setLogLevel(LogLevel level) {
+        log_level.store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+
+    LogLevel getLogLevel() {
+        return static_cast<LogLevel>(log_level.load(std::memory_order_relaxed));
+    }
+
+    bool logEnabled(LogLevel level) {
+        return level != LogLevel::OFF && static_cast<int>(level) >= log_level.load(std::memory_order_relaxed);
+    }
+
+    // ====================================
+    // Producers
+    // ====================================
+    void logMessage(LogLevel level, const char* format, ...) {
+        const int ring = thread_ring.get();
+        if (ring < 0) {
+            dropped_messages.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        LogRecord record;
+        record.level = level;
+        record.thread_index = static_cast<std::uint32_t>(ring);
+        record.timestamp_ns = readClockTicks();
+
+        va_list arguments;
+        va_start(arguments, format);
+        std::vsnprintf(record.text, sizeof(record.text), format, arguments);
+        va_end(arguments);
+
+        if (!LogBackend::instance().push(ring, record)) {
+            dropped_messages.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool registerLogThread() {
+        return thread_ring.get() >= 0;
+    }
+
+    // ====================================
+    // Consumer Side
+    // ====================================
+    void setLogSink(LogSink sink) {
+        LogBackend::instance().setSink(std::move(sink));
+    }
+
+    void flushLog() {
+        LogBackend::instance().flush();
+        std::cout.flush();
+    }
+
+    long long getDroppedLogMessages() {
+        return dropped_messages.load(std::memory_order_relaxed);
+    }
+
+} // namespace Syntri
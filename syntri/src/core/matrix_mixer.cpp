@@ -0,0 +1,374 @@
+// src/core/matrix_mixer.cpp
+// Cache-tiled, SIMD matrix mixer with per-cell gain smoothing
+
+#define _USE_MATH_DEFINES  // Enable M_PI in MSVC
+#include <cmath>
+
+#include "syntri/matrix_mixer.h"
+#include "syntri/audio_kernels.h"
+#include "syntri/trace.h"
+#include <algorithm>
+
+namespace Syntri {
+
+    namespace {
+        // Below this distance a gliding gain snaps to its target
+        constexpr float SMOOTHING_SNAP_THRESHOLD = 1.0e-6f;
+
+        float clampPan(float pan) {
+            return std::min(1.0f, std::max(-1.0f, pan));
+        }
+
+        // One block's worth of parallel mix rendering
+        struct MixRenderJob {
+            MatrixMixer* mixer;
+            const ConstAudioBlock* inputs;
+            const AudioBlock* outputs;
+        };
+    }
+
+    MatrixMixer::MatrixMixer(int num_inputs, int num_mixes)
+        : num_inputs_(std::min(std::max(num_inputs, 0), MAX_AUDIO_CHANNELS)),
+        num_mixes_(std::min(std::max(num_mixes, 0), MAX_PERSONAL_MIXES)),
+        sample_rate_(SAMPLE_RATE_96K), worker_pool_(nullptr),
+        smoothing_ms_(MIXER_DEFAULT_SMOOTHING_MS), command_queue_(MIXER_COMMAND_QUEUE_SIZE),
+        num_segments_(0), block_moving_(false), target_version_(0), seen_version_(0), settled_(true),
+        smoothing_frames_(0), smoothing_ms_used_(0.0), smoothing_coefficient_(1.0f) {
+        const int cells = num_inputs_ * num_mixes_;
+
+        target_gain_.reset(new std::atomic<float>[cells]);
+        target_pan_.reset(new std::atomic<float>[cells]);
+        mix_master_gain_.reset(new std::atomic<float>[num_mixes_]);
+        target_mute_.reset(new std::atomic<bool>[cells]);
+        for (int cell = 0; cell < cells; ++cell) {
+            target_gain_[cell].store(0.0f, std::memory_order_relaxed);
+            target_pan_[cell].store(0.0f, std::memory_order_relaxed);
+            target_mute_[cell].store(false, std::memory_order_relaxed);
+        }
+        for (int mix = 0; mix < num_mixes_; ++mix) {
+            mix_master_gain_[mix].store(1.0f, std::memory_order_relaxed);
+        }
+
+        current_left_.assign(cells, 0.0f);
+        current_right_.assign(cells, 0.0f);
+        next_left_.assign(cells, 0.0f);
+        next_right_.assign(cells, 0.0f);
+        seen_pan_.assign(cells, 0.0f);
+        pan_left_.assign(cells, 0.0f);
+        pan_right_.assign(cells, 0.0f);
+        for (int cell = 0; cell < cells; ++cell) {
+            updatePanLaw(cell, 0.0f);
+        }
+        pending_commands_.resize(MIXER_MAX_COMMANDS_PER_BLOCK);
+        segments_.resize(MIXER_MAX_COMMANDS_PER_BLOCK + 1);
+        mix_settled_.reset(new bool[num_mixes_]);
+        std::fill_n(mix_settled_.get(), num_mixes_, true);
+    }
+
+    // ====================================
+    // Control Thread API
+    // ====================================
+    void MatrixMixer::setGain(int input, int mix, float gain) {
+        if (input < 0 || input >= num_inputs_ || mix < 0 || mix >= num_mixes_) return;
+        target_gain_[cellIndex(input, mix)].store(std::max(gain, 0.0f), std::memory_order_relaxed);
+        target_version_.fetch_add(1, std::memory_order_release);
+    }
+
+    float MatrixMixer::getGain(int input, int mix) const {
+        if (input < 0 || input >= num_inputs_ || mix < 0 || mix >= num_mixes_) return 0.0f;
+        return target_gain_[cellIndex(input, mix)].load(std::memory_order_relaxed);
+    }
+
+    void MatrixMixer::setPan(int input, int mix, float pan) {
+        if (input < 0 || input >= num_inputs_ || mix < 0 || mix >= num_mixes_) return;
+        target_pan_[cellIndex(input, mix)].store(clampPan(pan), std::memory_order_relaxed);
+        target_version_.fetch_add(1, std::memory_order_release);
+    }
+
+    float MatrixMixer::getPan(int input, int mix) const {
+        if (input < 0 || input >= num_inputs_ || mix < 0 || mix >= num_mixes_) return 0.0f;
+        return target_pan_[cellIndex(input, mix)].load(std::memory_order_relaxed);
+    }
+
+    void MatrixMixer::setMute(int input, int mix, bool muted) {
+        if (input < 0 || input >= num_inputs_ || mix < 0 || mix >= num_mixes_) return;
+        target_mute_[cellIndex(input, mix)].store(muted, std::memory_order_relaxed);
+        target_version_.fetch_add(1, std::memory_order_release);
+    }
+
+    bool MatrixMixer::isMuted(int input, int mix) const {
+        if (input < 0 || input >= num_inputs_ || mix < 0 || mix >= num_mixes_) return false;
+        return target_mute_[cellIndex(input, mix)].load(std::memory_order_relaxed);
+    }
+
+    void MatrixMixer::setMixLevel(int mix, float gain) {
+        if (mix < 0 || mix >= num_mixes_) return;
+        mix_master_gain_[mix].store(std::max(gain, 0.0f), std::memory_order_relaxed);
+        target_version_.fetch_add(1, std::memory_order_release);
+    }
+
+    bool MatrixMixer::postCommand(const MixerCommand& command) {
+        return command_queue_.push(command);
+    }
+
+    void MatrixMixer::setSmoothingTime(double milliseconds) {
+        smoothing_ms_.store(std::max(milliseconds, 0.0), std::memory_order_relaxed);
+    }
+
+    void MatrixMixer::snapToTargets() {
+        seen_version_ = target_version_.load(std::memory_order_acquire);
+        for (int mix = 0; mix < num_mixes_; ++mix) {
+            mix_settled_[mix] = advanceMixSmoothing(mix, 1.0f);
+            commitMix(mix);
+        }
+        settled_ = true;
+    }
+
+    void MatrixMixer::setupChanged(int sample_rate, int /*buffer_size*/) {
+        sample_rate_ = sample_rate;
+        smoothing_frames_ = 0;
+    }
+
+    // ====================================
+    // Audio Thread
+    // ====================================
+    void MatrixMixer::updatePanLaw(int cell, float pan) {
+        double angle = (static_cast<double>(pan) + 1.0) * M_PI / 4.0;
+        seen_pan_[cell] = pan;
+        pan_left_[cell] = static_cast<float>(std::cos(angle));
+        pan_right_[cell] = static_cast<float>(std::sin(angle));
+    }
+
+    float MatrixMixer::smoothingCoefficient(int num_frames) {
+        const double smoothing_ms = smoothing_ms_.load(std::memory_order_relaxed);
+        if (num_frames != smoothing_frames_ || smoothing_ms != smoothing_ms_used_) {
+            double smoothing_frames = smoothing_ms * sample_rate_ / 1000.0;
+            smoothing_coefficient_ = smoothing_frames > 0.0
+                ? static_cast<float>(1.0 - std::exp(-num_frames / smoothing_frames))
+                : 1.0f;
+            smoothing_frames_ = num_frames;
+            smoothing_ms_used_ = smoothing_ms;
+        }
+        return smoothing_coefficient_;
+    }
+
+    bool MatrixMixer::advanceMixSmoothing(int mix, float k) {
+        bool settled = true;
+        const float master = mix_master_gain_[mix].load(std::memory_order_relaxed);
+        for (int input = 0; input < num_inputs_; ++input) {
+            const int cell = cellIndex(input, mix);
+
+            float pan = target_pan_[cell].load(std::memory_order_relaxed);
+            if (pan != seen_pan_[cell]) {
+                updatePanLaw(cell, pan);
+            }
+
+            float gain = target_mute_[cell].load(std::memory_order_relaxed)
+                ? 0.0f : target_gain_[cell].load(std::memory_order_relaxed) * master;
+            float target_left = gain * pan_left_[cell];
+            float target_right = gain * pan_right_[cell];
+
+            float left = current_left_[cell] + (target_left - current_left_[cell]) * k;
+            float right = current_right_[cell] + (target_right - current_right_[cell]) * k;
+
+            if (std::fabs(target_left - left) < SMOOTHING_SNAP_THRESHOLD) left = target_left;
+            else settled = false;
+            if (std::fabs(target_right - right) < SMOOTHING_SNAP_THRESHOLD) right = target_right;
+            else settled = false;
+
+            next_left_[cell] = left;
+            next_right_[cell] = right;
+        }
+        return settled;
+    }
+
+    void MatrixMixer::commitMix(int mix) {
+        const int first = cellIndex(0, mix);
+        std::copy_n(next_left_.begin() + first, num_inputs_, current_left_.begin() + first);
+        std::copy_n(next_right_.begin() + first, num_inputs_, current_right_.begin() + first);
+    }
+
+    void MatrixMixer::renderMix(int mix, const ConstAudioBlock& inputs, const AudioBlock& outputs,
+        int frame_start, int num_frames, int block_frames) const {
+        AudioSample* left = outputs.getChannel(2 * mix) + frame_start;
+        AudioSample* right = outputs.getChannel(2 * mix + 1) + frame_start;
+        Kernels::clear(left, num_frames);
+        Kernels::clear(right, num_frames);
+
+        const int available_inputs = std::min(num_inputs_, inputs.getNumChannels());
+        const float tile_begin = static_cast<float>(frame_start) / static_cast<float>(block_frames);
+        const float tile_end = static_cast<float>(frame_start + num_frames) / static_cast<float>(block_frames);
+
+        for (int input = 0; input < available_inputs; ++input) {
+            const int cell = cellIndex(input, mix);
+            const float l0 = current_left_[cell];
+            const float r0 = current_right_[cell];
+            const float l1 = next_left_[cell];
+            const float r1 = next_right_[cell];
+
+            if (l0 == 0.0f && r0 == 0.0f && l1 == 0.0f && r1 == 0.0f) {
+                continue;   // Not routed to this mix
+            }
+
+            const AudioSample* source = inputs.getChannel(input) + frame_start;
+            if (l0 == l1 && r0 == r1) {
+                Kernels::panAccumulate(source, left, right, num_frames, l0, r0);
+            }
+            else {
+                Kernels::panAccumulateRamp(source, left, right, num_frames,
+                    l0 + (l1 - l0) * tile_begin, l0 + (l1 - l0) * tile_end,
+                    r0 + (r1 - r0) * tile_begin, r0 + (r1 - r0) * tile_end);
+            }
+        }
+    }
+
+    void MatrixMixer::applyCommand(const MixerCommand& command) {
+        switch (command.type) {
+        case MixerCommandType::SET_GAIN:
+            setGain(command.input, command.mix, command.value);
+            break;
+        case MixerCommandType::SET_PAN:
+            setPan(command.input, command.mix, command.value);
+            break;
+        case MixerCommandType::SET_MUTE:
+            setMute(command.input, command.mix, command.value != 0.0f);
+            break;
+        case MixerCommandType::SET_MIX_LEVEL:
+            setMixLevel(command.mix, command.value);
+            break;
+        }
+    }
+
+    int MatrixMixer::drainCommands(int num_frames) {
+        const int last_frame = std::max(num_frames - 1, 0);
+        int count = 0;
+        MixerCommand command;
+        while (count < MIXER_MAX_COMMANDS_PER_BLOCK && command_queue_.pop(command)) {
+            command.sample_offset = std::min(std::max(command.sample_offset, 0), last_frame);
+
+            // Insertion sort keeps posting order among equal offsets
+            int position = count++;
+            while (position > 0 && pending_commands_[position - 1].sample_offset > command.sample_offset) {
+                pending_commands_[position] = pending_commands_[position - 1];
+                --position;
+            }
+            pending_commands_[position] = command;
+        }
+        return count;
+    }
+
+    void MatrixMixer::planSegments(int num_frames) {
+        const int num_commands = drainCommands(num_frames);
+        const unsigned version = target_version_.load(std::memory_order_acquire);
+        block_moving_ = num_commands > 0 || version != seen_version_ || !settled_;
+        seen_version_ = version;
+
+        // Split the block at each command so it takes effect on its own frame
+        num_segments_ = 0;
+        int command = 0;
+        int segment_start = 0;
+        do {
+            Segment& segment = segments_[num_segments_++];
+            segment.start = segment_start;
+            segment.first_command = command;
+            while (command < num_commands && pending_commands_[command].sample_offset <= segment_start) {
+                ++command;
+            }
+            segment.end_command = command;
+            const int segment_end = command < num_commands ? pending_commands_[command].sample_offset : num_frames;
+            segment.frames = segment_end - segment_start;
+            segment.coefficient = smoothingCoefficient(segment.frames);
+            segment_start = segment_end;
+        } while (segment_start < num_frames);
+    }
+
+    void MatrixMixer::beginSegment(int mix, const Segment& segment) {
+        for (int command = segment.first_command; command < segment.end_command; ++command) {
+            if (pending_commands_[command].mix == mix) {
+                applyCommand(pending_commands_[command]);
+            }
+        }
+        if (block_moving_) {
+            mix_settled_[mix] = advanceMixSmoothing(mix, segment.coefficient);
+        }
+    }
+
+    void MatrixMixer::endSegment(int mix) {
+        if (block_moving_) {
+            commitMix(mix);
+        }
+    }
+
+    void MatrixMixer::processMix(int mix, const ConstAudioBlock& inputs, const AudioBlock& outputs, bool render) {
+        for (int index = 0; index < num_segments_; ++index) {
+            const Segment& segment = segments_[index];
+            beginSegment(mix, segment);
+            if (render) {
+                const ConstAudioBlock segment_inputs = inputs.getSubBlock(segment.start, segment.frames);
+                const AudioBlock segment_outputs = outputs.getSubBlock(segment.start, segment.frames);
+                for (int tile_start = 0; tile_start < segment.frames; tile_start += MIXER_TILE_FRAMES) {
+                    int tile_frames = std::min(MIXER_TILE_FRAMES, segment.frames - tile_start);
+                    renderMix(mix, segment_inputs, segment_outputs, tile_start, tile_frames, segment.frames);
+                }
+            }
+            endSegment(mix);
+        }
+    }
+
+    void MatrixMixer::processMixTask(void* context, int mix) {
+        const MixRenderJob& job = *static_cast<const MixRenderJob*>(context);
+        job.mixer->processMix(mix, *job.inputs, *job.outputs, true);
+    }
+
+    void MatrixMixer::processAudio(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+        TraceScope trace_scope("mixer");
+        const int frames = outputs.getNumFrames();
+        const int mixes = std::min(num_mixes_, outputs.getNumChannels() / 2);
+        planSegments(frames);
+
+        if (worker_pool_ && worker_pool_->getNumWorkers() > 0 && mixes > 1) {
+            // The interface's deadline for the whole callback, not one period from
+            // here - something may have run before the mixer (ProcessingGraph)
+            const std::uint64_t callback_deadline = getCallbackDeadlineTicks();
+            const std::uint64_t deadline = callback_deadline > 0 ? callback_deadline : UINT64_MAX;
+
+            // Mixes are independent - fan out once for the whole block, join,
+            // and count a miss if the callback deadline passed
+            MixRenderJob job{ this, &inputs, &outputs };
+            worker_pool_->run(mixes, processMixTask, &job, deadline);
+        }
+        else if (num_segments_ == 1) {
+            // Tile over frames so each tile of every input is reused by all mixes
+            for (int mix = 0; mix < mixes; ++mix) {
+                beginSegment(mix, segments_[0]);
+            }
+            for (int tile_start = 0; tile_start < frames; tile_start += MIXER_TILE_FRAMES) {
+                int tile_frames = std::min(MIXER_TILE_FRAMES, frames - tile_start);
+                for (int mix = 0; mix < mixes; ++mix) {
+                    renderMix(mix, inputs, outputs, tile_start, tile_frames, frames);
+                }
+            }
+            for (int mix = 0; mix < mixes; ++mix) {
+                endSegment(mix);
+            }
+        }
+        else {
+            for (int mix = 0; mix < mixes; ++mix) {
+                processMix(mix, inputs, outputs, true);
+            }
+        }
+
+        // Mixes with no room in the output still take their commands and glide
+        for (int mix = mixes; mix < num_mixes_; ++mix) {
+            processMix(mix, inputs, outputs, false);
+        }
+
+        if (block_moving_) {
+            settled_ = std::all_of(mix_settled_.get(), mix_settled_.get() + num_mixes_, [](bool settled) { return settled; });
+        }
+        for (int ch = 2 * mixes; ch < outputs.getNumChannels(); ++ch) {
+            Kernels::clear(outputs.getChannel(ch), frames);
+        }
+    }
+
+} // namespace Syntri
@@ -0,0 +1,257 @@
+// src/core/offline_interface.cpp
+// Offline renderer - back-to-back processAudio calls over in-memory files
+
+#include "syntri/offline_interface.h"
+#include "syntri/clock.h"
+#include "syntri/log.h"
+#include "syntri/perf_counters.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+
+namespace Syntri {
+
+    OfflineAudioInterface::OfflineAudioInterface(const OfflineRenderOptions& options)
+        : options_(options), initialized_(false), sample_rate_(SAMPLE_RATE_96K),
+        buffer_size_(BUFFER_SIZE_ULTRA_LOW), processor_(nullptr), streaming_(false),
+        stop_requested_(false), total_frames_(0), output_ok_(false), hardware_counters_enabled_(false) {
+        thread_options_.use_realtime_priority = false;
+        thread_options_.lock_memory = false;
+        thread_options_.prefault_stack_bytes = 0;
+    }
+
+    OfflineAudioInterface::~OfflineAudioInterface() {
+        stopStreaming();
+        shutdown();
+    }
+
+    // ====================================
+    // Lifecycle
+    // ====================================
+    bool OfflineAudioInterface::initialize(int sample_rate, int buffer_size) {
+        if (sample_rate <= 0 || buffer_size <= 0) {
+            SYNTRI_LOG_WARNING("Invalid offline render configuration");
+            return false;
+        }
+        sample_rate_ = sample_rate;
+        buffer_size_ = buffer_size;
+
+        std::vector<AudioSample> interleaved;
+        AudioFileInfo info;
+        if (options_.input_path.empty()) {
+            info.num_channels = options_.num_input_channels;
+            info.num_frames = options_.length_frames;
+        }
+        else {
+            std::string error;
+            if (!readAudioFile(options_.input_path, options_.input_format, options_.raw_input_channels,
+                info, interleaved, error)) {
+                SYNTRI_LOG_WARNING("Offline render: %s", error.c_str());
+                return false;
+            }
+            // A WAV file's own rate wins - there is no device to negotiate with
+            if (info.sample_rate > 0 && info.sample_rate != sample_rate_) {
+                SYNTRI_LOG_INFO("Offline render: using file sample rate %d Hz", info.sample_rate);
+                sample_rate_ = info.sample_rate;
+            }
+        }
+
+        if (info.num_channels <= 0 || info.num_channels > MAX_AUDIO_CHANNELS ||
+            info.num_frames < 0 || info.num_frames > INT_MAX - buffer_size_) {
+            SYNTRI_LOG_WARNING("Offline render: unsupported input (%d channels, %lld frames)",
+                info.num_channels, info.num_frames);
+            return false;
+        }
+
+        // Pad to whole blocks so the processor always sees buffer_size frames
+        total_frames_ = info.num_frames;
+        const int padded_frames = static_cast<int>((total_frames_ + buffer_size_ - 1) / buffer_size_ * buffer_size_);
+        input_storage_.allocate(info.num_channels, padded_frames);
+
+        AudioBlock input = input_storage_.getBlock();
+        for (long long frame = 0; frame < static_cast<long long>(interleaved.size()) / info.num_channels; ++frame) {
+            for (int ch = 0; ch < info.num_channels; ++ch) {
+                input.getChannel(ch)[frame] = interleaved[frame * info.num_channels + ch];
+            }
+        }
+
+        initialized_ = true;
+        SYNTRI_LOG_INFO("Offline renderer initialized (%d channels, %lld frames @ %d Hz, Buffer: %d)",
+            info.num_channels, total_frames_, sample_rate_, buffer_size_);
+        return true;
+    }
+
+    void OfflineAudioInterface::shutdown() {
+        if (!initialized_) return;
+        stopStreaming();
+        input_storage_ = AudioBlockStorage();
+        output_storage_ = AudioBlockStorage();
+        initialized_ = false;
+    }
+
+    int OfflineAudioInterface::getInputChannelCount() const {
+        return input_storage_.getNumChannels();
+    }
+
+    int OfflineAudioInterface::getOutputChannelCount() const {
+        return options_.num_output_channels > 0
+            ? std::min(options_.num_output_channels, MAX_AUDIO_CHANNELS)
+            : input_storage_.getNumChannels();
+    }
+
+    double OfflineAudioInterface::getCurrentLatency() const {
+        return (static_cast<double>(buffer_size_) / static_cast<double>(sample_rate_)) * 1000.0;
+    }
+
+    // ====================================
+    // Rendering
+    // ====================================
+    bool OfflineAudioInterface::prepare(AudioProcessor* processor) {
+        if (!initialized_ || !processor) {
+            SYNTRI_LOG_WARNING("Cannot render - not initialized or no processor");
+            return false;
+        }
+        if (streaming_.load(std::memory_order_acquire)) {
+            SYNTRI_LOG_WARNING("Cannot render - a render is already running");
+            return false;
+        }
+        // A background render that ran to the end leaves its thread to be joined
+        if (render_thread_.joinable()) {
+            render_thread_.join();
+        }
+
+        processor_ = processor;
+        output_storage_.allocate(getOutputChannelCount(), input_storage_.getNumFrames());
+        legacy_bridge_.prepare(getInputChannelCount(), getOutputChannelCount(), buffer_size_);
+
+        metrics_.reset();
+        metrics_.setPeriod(sample_rate_, buffer_size_);
+        stats_ = OfflineRenderStats();
+        output_ok_ = false;
+        stop_requested_.store(false, std::memory_order_relaxed);
+
+        processor_->setupChanged(sample_rate_, buffer_size_);
+        return true;
+    }
+
+    void OfflineAudioInterface::renderBlocks() {
+        using Clock = std::chrono::steady_clock;
+
+        const int padded_frames = input_storage_.getNumFrames();
+        const ConstAudioBlock input = static_cast<const AudioBlockStorage&>(input_storage_).getBlock();
+        const AudioBlock output = output_storage_.getBlock();
+
+        PerfCounterGroup counters;
+        if (hardware_counters_enabled_) {
+            std::string notes;
+            counters.open(&notes);
+            metrics_.setHardwareCounterMask(counters.availableMask());
+            if (!notes.empty()) {
+                SYNTRI_LOG_INFO("Offline hardware counters: %s", notes.c_str());
+            }
+        }
+        PerfCounterValues counts_before;
+        PerfCounterValues counts_after;
+
+        const auto render_start = Clock::now();
+        int frame = 0;
+        for (; frame < padded_frames && !stop_requested_.load(std::memory_order_relaxed); frame += buffer_size_) {
+            const std::uint64_t block_start = readClockTicks();
+            if (counters.isOpen()) counters.read(counts_before);
+            invokeProcessor(*processor_, legacy_bridge_,
+                input.getSubBlock(frame, buffer_size_), output.getSubBlock(frame, buffer_size_));
+            if (counters.isOpen()) {
+                counters.read(counts_after);
+                metrics_.recordHardwareCounters(PerfCounterValues::difference(counts_after, counts_before));
+            }
+            const std::uint64_t block_end = readClockTicks();
+
+            metrics_.recordCallback(clockTicksToNanoseconds(block_end - block_start), 0);
+            ++stats_.blocks_rendered;
+        }
+
+        stats_.render_seconds = std::chrono::duration<double>(Clock::now() - render_start).count();
+        stats_.frames_rendered = std::min<long long>(frame, total_frames_);
+        stats_.audio_seconds = static_cast<double>(stats_.frames_rendered) / sample_rate_;
+        stats_.realtime_multiple = stats_.render_seconds > 0.0 ? stats_.audio_seconds / stats_.render_seconds : 0.0;
+    }
+
+    void OfflineAudioInterface::finish() {
+        SYNTRI_LOG_INFO("Offline render: %g s of audio in %g s (%gx real time)",
+            stats_.audio_seconds, stats_.render_seconds, stats_.realtime_multiple);
+
+        output_ok_ = true;
+        if (!options_.output_path.empty()) {
+            std::string error;
+            ConstAudioBlock rendered = getOutput().getSubBlock(0, static_cast<int>(stats_.frames_rendered));
+            output_ok_ = writeAudioFile(options_.output_path, options_.output_format, rendered, sample_rate_, error);
+            if (!output_ok_) {
+                SYNTRI_LOG_WARNING("Offline render: %s", error.c_str());
+            }
+        }
+    }
+
+    bool OfflineAudioInterface::render(AudioProcessor* processor) {
+        if (!prepare(processor)) return false;
+        {
+            ScopedDenormalFlush flush;
+            renderBlocks();
+        }
+        finish();
+        processor_ = nullptr;
+        return output_ok_;
+    }
+
+    bool OfflineAudioInterface::startStreaming(AudioProcessor* processor) {
+        if (!prepare(processor)) return false;
+
+        streaming_.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(thread_status_mutex_);
+            thread_status_ = RealtimeThreadStatus();
+        }
+        render_thread_ = std::thread([this]() {
+            RealtimeThreadStatus status = configureCurrentThreadForAudio(thread_options_);
+            {
+                std::lock_guard<std::mutex> lock(thread_status_mutex_);
+                thread_status_ = status;
+            }
+            setTraceThreadName("Offline render");
+            renderBlocks();
+            finish();
+            streaming_.store(false, std::memory_order_release);
+        });
+        return true;
+    }
+
+    void OfflineAudioInterface::waitForCompletion() {
+        if (render_thread_.joinable()) {
+            render_thread_.join();
+        }
+    }
+
+    void OfflineAudioInterface::stopStreaming() {
+        stop_requested_.store(true, std::memory_order_relaxed);
+        waitForCompletion();
+        processor_ = nullptr;
+    }
+
+    SimpleMetrics OfflineAudioInterface::getMetrics() const {
+        return metrics_.snapshot().toSimpleMetrics(getCurrentLatency());
+    }
+
+    RealtimeThreadStatus OfflineAudioInterface::getRealtimeThreadStatus() const {
+        std::lock_guard<std::mutex> lock(thread_status_mutex_);
+        return thread_status_;
+    }
+
+    ConstAudioBlock OfflineAudioInterface::getOutput() const {
+        return output_storage_.getBlock().getSubBlock(0, static_cast<int>(std::min<long long>(
+            total_frames_, output_storage_.getNumFrames())));
+    }
+
+    std::unique_ptr<OfflineAudioInterface> createOfflineInterface(const OfflineRenderOptions& options) {
+        return std::make_unique<OfflineAudioInterface>(options);
+    }
+
+} // namespace Syntri
@@ -0,0 +1,179 @@
+// src/core/perf_counters.cpp
+// perf_event_open counters with a user-space rdpmc fast path
+
+#include "syntri/perf_counters.h"
+#include "syntri/rt_safety.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define SYNTRI_HAS_RDPMC 1
+#endif
+
+namespace Syntri {
+
+    namespace {
+        const char* const COUNTER_NAMES[PERF_COUNTER_COUNT] = {
+            "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"
+        };
+
+#if defined(__linux__)
+        void fillAttributes(int index, perf_event_attr& attributes) {
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.size = sizeof(attributes);
+            attributes.exclude_kernel = 1;      // Allowed at perf_event_paranoid 2
+            attributes.exclude_hv = 1;
+
+            switch (static_cast<PerfCounter>(index)) {
+            case PerfCounter::CYCLES:
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case PerfCounter::INSTRUCTIONS:
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case PerfCounter::L1D_MISSES:
+                attributes.type = PERF_TYPE_HW_CACHE;
+                attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case PerfCounter::LLC_MISSES:
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case PerfCounter::BRANCH_MISSES:
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            }
+        }
+#endif
+    }
+
+    const char* perfCounterName(PerfCounter counter) {
+        return COUNTER_NAMES[static_cast<int>(counter)];
+    }
+
+    PerfCounterValues PerfCounterValues::difference(const PerfCounterValues& after, const PerfCounterValues& before) {
+        PerfCounterValues result;
+        for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+            result.values[i] = after.values[i] >= before.values[i] ? after.values[i] - before.values[i] : 0;
+        }
+        return result;
+    }
+
+    // ====================================
+    // Lifecycle
+    // ====================================
+    PerfCounterGroup::PerfCounterGroup() : available_mask_(0) {
+        fds_.fill(-1);
+        pages_.fill(nullptr);
+    }
+
+    PerfCounterGroup::~PerfCounterGroup() {
+        close();
+    }
+
+    bool PerfCounterGroup::open(std::string* notes) {
+        close();
+#if defined(__linux__)
+        const long page_size = sysconf(_SC_PAGESIZE);
+        for (int index = 0; index < PERF_COUNTER_COUNT; ++index) {
+            perf_event_attr attributes;
+            fillAttributes(index, attributes);
+
+            // pid 0, cpu -1: this thread, wherever it runs
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+            if (fd < 0) {
+                if (notes) {
+                    if (!notes->empty()) *notes += "; ";
+                    *notes += std::string(COUNTER_NAMES[index]) + " unavailable (" + std::strerror(errno) + ")";
+                }
+                continue;
+            }
+
+            fds_[index] = fd;
+            available_mask_ |= 1u << index;
+
+            // The mapped page carries what rdpmc needs; without it read() is used
+            void* page = mmap(nullptr, static_cast<size_t>(page_size), PROT_READ, MAP_SHARED, fd, 0);
+            pages_[index] = page == MAP_FAILED ? nullptr : page;
+        }
+#else
+        if (notes) *notes = "Hardware counters need Linux perf_event_open";
+#endif
+        return isOpen();
+    }
+
+    void PerfCounterGroup::close() {
+#if defined(__linux__)
+        const long page_size = sysconf(_SC_PAGESIZE);
+        for (int index = 0; index < PERF_COUNTER_COUNT; ++index) {
+            if (pages_[index]) munmap(pages_[index], static_cast<size_t>(page_size));
+            if (fds_[index] >= 0) ::close(fds_[index]);
+        }
+#endif
+        fds_.fill(-1);
+        pages_.fill(nullptr);
+        available_mask_ = 0;
+    }
+
+    // ====================================
+    // Reading
+    // ====================================
+    std::uint64_t PerfCounterGroup::readCounter(int index) const {
+#if defined(__linux__)
+#if defined(SYNTRI_HAS_RDPMC)
+        // Seqlock protocol from linux/perf_event.h: retry if the kernel
+        // rescheduled the counter while we were reading it
+        if (const auto* page = static_cast<const volatile perf_event_mmap_page*>(pages_[index])) {
+            std::uint32_t sequence;
+            std::uint64_t count = 0;
+            bool user_readable;
+            do {
+                sequence = page->lock;
+                __atomic_signal_fence(__ATOMIC_ACQUIRE);
+                const std::uint32_t hardware_index = page->index;
+                user_readable = page->cap_user_rdpmc && hardware_index != 0;
+                if (user_readable) {
+                    const int width = page->pmc_width;
+                    std::int64_t value = static_cast<std::int64_t>(__rdpmc(static_cast<int>(hardware_index - 1)));
+                    value = static_cast<std::int64_t>(static_cast<std::uint64_t>(value) << (64 - width)) >> (64 - width);
+                    count = static_cast<std::uint64_t>(page->offset + value);
+                }
+                __atomic_signal_fence(__ATOMIC_ACQUIRE);
+            } while (page->lock != sequence);
+
+            if (user_readable) return count;
+        }
+#endif
+        // Deliberate syscall in an opt-in measurement mode
+        RealtimeSafetyExemption exemption;
+        std::uint64_t count = 0;
+        if (::read(fds_[index], &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+            return 0;
+        }
+        return count;
+#else
+        (void)index;
+        return 0;
+#endif
+    }
+
+    void PerfCounterGroup::read(PerfCounterValues& values) const {
+        for (int index = 0; index < PERF_COUNTER_COUNT; ++index) {
+            values.values[index] = (available_mask_ >> index) & 1u ? readCounter(index) : 0;
+        }
+    }
+
+} // namespace Syntri
@@ -0,0 +1,149 @@
+// src/core/period_scheduler.cpp
+// Absolute sleeps, spin-to-deadline and adaptive spin margin
+
+#include "syntri/period_scheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <time.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#define SYNTRI_CPU_RELAX() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define SYNTRI_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define SYNTRI_CPU_RELAX() ((void)0)
+#endif
+
+namespace Syntri {
+
+    namespace {
+        constexpr std::uint64_t NS_PER_SECOND = 1000000000ULL;
+        constexpr int PEAK_DECAY_SHIFT = 6;     // Peak loses 1/64 per period
+    }
+
+    bool defaultPeriodSpinEnabled() {
+        return std::thread::hardware_concurrency() > 1;
+    }
+
+    PeriodScheduler::PeriodScheduler(const PeriodSchedulerOptions& options)
+        : options_(options), sample_rate_(0), buffer_size_(0), start_ns_(0), period_ns_(0),
+        next_period_(1), overshoot_peak_ns_(0), spin_margin_ns_(0) {
+    }
+
+    std::uint64_t PeriodScheduler::nowNanoseconds() {
+#if defined(__linux__)
+        timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<std::uint64_t>(now.tv_sec) * NS_PER_SECOND + static_cast<std::uint64_t>(now.tv_nsec);
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    void PeriodScheduler::start(int sample_rate, int buffer_size) {
+        start(sample_rate, buffer_size, nowNanoseconds());
+    }
+
+    void PeriodScheduler::start(int sample_rate, int buffer_size, std::uint64_t start_ns) {
+        sample_rate_ = std::max(sample_rate, 1);
+        buffer_size_ = std::max(buffer_size, 1);
+        start_ns_ = start_ns;
+        period_ns_ = static_cast<std::int64_t>(deadlineNanoseconds(1) - start_ns_);
+        next_period_ = 1;
+
+        overshoot_peak_ns_ = options_.initial_spin_margin_ns;
+        spin_margin_ns_ = 0;
+        adaptMargin(0);
+    }
+
+    std::uint64_t PeriodScheduler::deadlineNanoseconds(long long period_index) const {
+        const std::uint64_t frames = static_cast<std::uint64_t>(period_index) * static_cast<std::uint64_t>(buffer_size_);
+        const std::uint64_t rate = static_cast<std::uint64_t>(sample_rate_);
+        return start_ns_ + (frames / rate) * NS_PER_SECOND + ((frames % rate) * NS_PER_SECOND) / rate;
+    }
+
+    // ====================================
+    // Waiting
+    // ====================================
+    void PeriodScheduler::sleepUntil(std::uint64_t target_ns) const {
+#if defined(__linux__)
+        timespec target;
+        target.tv_sec = static_cast<time_t>(target_ns / NS_PER_SECOND);
+        target.tv_nsec = static_cast<long>(target_ns % NS_PER_SECOND);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {
+        }
+#else
+        std::this_thread::sleep_until(std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(target_ns))));
+#endif
+    }
+
+    void PeriodScheduler::adaptMargin(std::int64_t overshoot_ns) {
+        overshoot_peak_ns_ = std::max(overshoot_ns, overshoot_peak_ns_ - (overshoot_peak_ns_ >> PEAK_DECAY_SHIFT));
+
+        const std::int64_t ceiling = static_cast<std::int64_t>(period_ns_ * options_.max_spin_fraction);
+        const std::int64_t wanted = overshoot_peak_ns_ + overshoot_peak_ns_ / 4;
+        spin_margin_ns_ = std::min(std::max(wanted, options_.min_spin_margin_ns), std::max<std::int64_t>(ceiling, 0));
+    }
+
+    std::uint64_t PeriodScheduler::claimNextBoundary(std::uint64_t now_ns, PeriodWake& wake) {
+        long long index = next_period_;
+        std::uint64_t deadline = deadlineNanoseconds(index);
+        if (now_ns > deadline + static_cast<std::uint64_t>(period_ns_)) {
+            // Resume at the first boundary still ahead of us
+            const std::uint64_t elapsed = now_ns - start_ns_;
+            const std::uint64_t rate = static_cast<std::uint64_t>(sample_rate_);
+            const std::uint64_t frames = (elapsed / NS_PER_SECOND) * rate + ((elapsed % NS_PER_SECOND) * rate) / NS_PER_SECOND;
+            const long long resume = static_cast<long long>(frames / static_cast<std::uint64_t>(buffer_size_)) + 1;
+            wake.skipped_periods = resume - index;
+            index = resume;
+            deadline = deadlineNanoseconds(index);
+        }
+        next_period_ = index + 1;
+        wake.period_index = index;
+        return deadline;
+    }
+
+    PeriodWake PeriodScheduler::advance(std::uint64_t now_ns) {
+        PeriodWake wake;
+        const std::uint64_t deadline = claimNextBoundary(now_ns, wake);
+        wake.lateness_ns = now_ns > deadline ? static_cast<std::int64_t>(now_ns - deadline) : 0;
+        return wake;
+    }
+
+    PeriodWake PeriodScheduler::waitForNextPeriod() {
+        PeriodWake wake;
+        std::uint64_t now = nowNanoseconds();
+        const std::uint64_t deadline = claimNextBoundary(now, wake);
+
+        if (options_.spin) {
+            const std::uint64_t sleep_target = deadline - static_cast<std::uint64_t>(spin_margin_ns_);
+            if (now < sleep_target) {
+                sleepUntil(sleep_target);
+                now = nowNanoseconds();
+                adaptMargin(static_cast<std::int64_t>(now - sleep_target));
+            }
+            const std::uint64_t spin_start = now;
+            while (now < deadline) {
+                SYNTRI_CPU_RELAX();
+                now = nowNanoseconds();
+            }
+            wake.spin_ns = static_cast<std::int64_t>(now - spin_start);
+        }
+        else if (now < deadline) {
+            sleepUntil(deadline);
+            now = nowNanoseconds();
+        }
+
+        wake.lateness_ns = static_cast<std::int64_t>(now) - static_cast<std::int64_t>(deadline);
+        return wake;
+    }
+
+} // namespace Syntri
@@ -0,0 +1,326 @@
+// src/core/processing_graph.cpp
+// Level sort, buffer lifetime packing and plan execution for the processing graph
+
+#include "syntri/processing_graph.h"
+#include "syntri/audio_kernels.h"
+#include "syntri/log.h"
+#include "syntri/trace.h"
+#include <algorithm>
+#include <numeric>
+
+namespace Syntri {
+
+    ProcessingGraph::ProcessingGraph(int num_inputs, int num_outputs)
+        : num_inputs_(std::max(num_inputs, 0)), num_outputs_(std::max(num_outputs, 0)), max_frames_(0),
+        compiled_(false), worker_pool_(nullptr), pool_channels_(0), intermediate_channels_(0), block_frames_(0),
+        running_level_(0) {
+    }
+
+    // ====================================
+    // Editing
+    // ====================================
+    int ProcessingGraph::addNode(AudioProcessor* processor, int num_inputs, int num_outputs) {
+        Node node;
+        node.processor = processor;
+        node.num_inputs = std::max(num_inputs, 0);
+        node.num_outputs = std::max(num_outputs, 0);
+        nodes_.push_back(std::move(node));
+        compiled_ = false;
+        return static_cast<int>(nodes_.size()) - 1;
+    }
+
+    bool ProcessingGraph::connect(int from_node, int from_channel, int to_node, int to_channel) {
+        const int node_count = static_cast<int>(nodes_.size());
+        const int from_channels = from_node == GRAPH_INPUT_NODE ? num_inputs_
+            : (from_node >= 0 && from_node < node_count ? nodes_[static_cast<size_t>(from_node)].num_outputs : -1);
+        const int to_channels = to_node == GRAPH_OUTPUT_NODE ? num_outputs_
+            : (to_node >= 0 && to_node < node_count ? nodes_[static_cast<size_t>(to_node)].num_inputs : -1);
+
+        if (from_channel < 0 || from_channel >= from_channels || to_channel < 0 || to_channel >= to_channels) {
+            SYNTRI_LOG_WARNING("Graph edge %d:%d -> %d:%d is out of range", from_node, from_channel, to_node, to_channel);
+            return false;
+        }
+
+        edges_.push_back({ from_node, from_channel, to_node, to_channel });
+        compiled_ = false;
+        return true;
+    }
+
+    // ====================================
+    // Compilation
+    // ====================================
+    bool ProcessingGraph::compile(int max_frames) {
+        compiled_ = false;
+        max_frames_ = std::max(max_frames, 1);
+        const int node_count = static_cast<int>(nodes_.size());
+
+        // Levels by Kahn's algorithm: a node is placed once every feeder is
+        std::vector<int> pending_feeders(static_cast<size_t>(node_count), 0);
+        std::vector<std::vector<int>> successors(static_cast<size_t>(node_count));
+        for (const Edge& edge : edges_) {
+            if (edge.from_node >= 0 && edge.to_node >= 0) {
+                successors[static_cast<size_t>(edge.from_node)].push_back(edge.to_node);
+                pending_feeders[static_cast<size_t>(edge.to_node)]++;
+            }
+        }
+
+        std::vector<int> ready;
+        for (int node = 0; node < node_count; ++node) {
+            nodes_[static_cast<size_t>(node)].level = 0;
+            if (pending_feeders[static_cast<size_t>(node)] == 0) ready.push_back(node);
+        }
+        int placed = 0;
+        int num_levels = 0;
+        while (!ready.empty()) {
+            const int node = ready.back();
+            ready.pop_back();
+            placed++;
+            const int level = nodes_[static_cast<size_t>(node)].level;
+            num_levels = std::max(num_levels, level + 1);
+            for (int successor : successors[static_cast<size_t>(node)]) {
+                Node& next = nodes_[static_cast<size_t>(successor)];
+                next.level = std::max(next.level, level + 1);
+                if (--pending_feeders[static_cast<size_t>(successor)] == 0) ready.push_back(successor);
+            }
+        }
+        if (placed != node_count) {
+            SYNTRI_LOG_WARNING("Processing graph has a cycle - %d of %d nodes could not be ordered",
+                node_count - placed, node_count);
+            return false;
+        }
+
+        levels_.assign(static_cast<size_t>(num_levels), std::vector<int>());
+        for (int node = 0; node < node_count; ++node) {
+            levels_[static_cast<size_t>(nodes_[static_cast<size_t>(node)].level)].push_back(node);
+        }
+
+        // Every node output, and every multi-edge sum, is a channel value
+        // alive from the level that writes it to the last level that reads it.
+        // Graph outputs read after the last level.
+        std::vector<int> value_start;
+        std::vector<int> value_end;
+        std::vector<int> output_value(static_cast<size_t>(node_count));
+        for (int node = 0; node < node_count; ++node) {
+            const Node& current = nodes_[static_cast<size_t>(node)];
+            output_value[static_cast<size_t>(node)] = static_cast<int>(value_start.size());
+            value_start.insert(value_start.end(), static_cast<size_t>(current.num_outputs), current.level);
+            value_end.insert(value_end.end(), static_cast<size_t>(current.num_outputs), current.level);
+        }
+        for (const Edge& edge : edges_) {
+            if (edge.from_node < 0) continue;
+            const int reader_level = edge.to_node >= 0 ? nodes_[static_cast<size_t>(edge.to_node)].level : num_levels;
+            int& end = value_end[static_cast<size_t>(output_value[static_cast<size_t>(edge.from_node)] + edge.from_channel)];
+            end = std::max(end, reader_level);
+        }
+
+        // Edges grouped by the input they feed
+        auto sourcesOf = [this](int node, int channel) {
+            std::vector<const Edge*> sources;
+            for (const Edge& edge : edges_) {
+                if (edge.to_node == node && edge.to_channel == channel) sources.push_back(&edge);
+            }
+            return sources;
+        };
+        std::vector<int> sum_value;     // Per node input channel with several sources, else -1
+        std::vector<int> input_base(static_cast<size_t>(node_count));
+        for (int node = 0; node < node_count; ++node) {
+            const Node& current = nodes_[static_cast<size_t>(node)];
+            input_base[static_cast<size_t>(node)] = static_cast<int>(sum_value.size());
+            for (int channel = 0; channel < current.num_inputs; ++channel) {
+                if (sourcesOf(node, channel).size() > 1) {
+                    sum_value.push_back(static_cast<int>(value_start.size()));
+                    value_start.push_back(current.level);
+                    value_end.push_back(current.level);
+                }
+                else {
+                    sum_value.push_back(-1);
+                }
+            }
+        }
+
+        // Pack lifetimes into pool channels, first fit in start order. Nodes of
+        // one level run together, so a channel is only reused strictly after
+        // its last reader's level.
+        const int value_count = static_cast<int>(value_start.size());
+        std::vector<int> by_start(static_cast<size_t>(value_count));
+        std::iota(by_start.begin(), by_start.end(), 0);
+        std::stable_sort(by_start.begin(), by_start.end(),
+            [&value_start](int a, int b) { return value_start[static_cast<size_t>(a)] < value_start[static_cast<size_t>(b)]; });
+        std::vector<int> slot_of(static_cast<size_t>(value_count));
+        std::vector<int> slot_end;
+        for (int value : by_start) {
+            const int start = value_start[static_cast<size_t>(value)];
+            size_t slot = 0;
+            while (slot < slot_end.size() && slot_end[slot] >= start) ++slot;
+            if (slot == slot_end.size()) slot_end.push_back(0);
+            slot_end[slot] = value_end[static_cast<size_t>(value)];
+            slot_of[static_cast<size_t>(value)] = static_cast<int>(slot);
+        }
+        intermediate_channels_ = value_count;
+        pool_channels_ = static_cast<int>(slot_end.size());
+        pool_.allocate(std::max(pool_channels_, 1), max_frames_);
+        silence_.allocate(1, max_frames_);
+
+        const AudioBlock pool = pool_.getBlock();
+        const AudioSample* silence = silence_.getBlock().getChannel(0);
+        auto valuePointer = [&](int value) { return pool.getChannel(slot_of[static_cast<size_t>(value)]); };
+
+        // Flatten the plan into pointer tables
+        source_table_.clear();
+        output_table_.clear();
+        sums_.clear();
+        input_patches_.clear();
+        graph_output_sources_.clear();
+
+        auto appendSource = [&](const Edge& edge) {
+            if (edge.from_node == GRAPH_INPUT_NODE) {
+                input_patches_.push_back({ static_cast<int>(source_table_.size()), edge.from_channel });
+                source_table_.push_back(silence);
+            }
+            else {
+                source_table_.push_back(valuePointer(output_value[static_cast<size_t>(edge.from_node)] + edge.from_channel));
+            }
+        };
+
+        for (int node = 0; node < node_count; ++node) {
+            Node& current = nodes_[static_cast<size_t>(node)];
+            current.output_table = static_cast<int>(output_table_.size());
+            for (int channel = 0; channel < current.num_outputs; ++channel) {
+                output_table_.push_back(valuePointer(output_value[static_cast<size_t>(node)] + channel));
+            }
+
+            // Single sources are read in place; sums land in their own channel
+            current.input_table = static_cast<int>(source_table_.size());
+            for (int channel = 0; channel < current.num_inputs; ++channel) {
+                const std::vector<const Edge*> sources = sourcesOf(node, channel);
+                const int sum = sum_value[static_cast<size_t>(input_base[static_cast<size_t>(node)] + channel)];
+                if (sum >= 0) {
+                    source_table_.push_back(valuePointer(sum));
+                }
+                else if (sources.empty()) {
+                    source_table_.push_back(silence);
+                }
+                else {
+                    appendSource(*sources.front());
+                }
+            }
+
+            current.first_sum = static_cast<int>(sums_.size());
+            for (int channel = 0; channel < current.num_inputs; ++channel) {
+                const int sum = sum_value[static_cast<size_t>(input_base[static_cast<size_t>(node)] + channel)];
+                if (sum < 0) continue;
+                const std::vector<const Edge*> sources = sourcesOf(node, channel);
+                const int first_source = static_cast<int>(source_table_.size());
+                for (const Edge* edge : sources) appendSource(*edge);
+                sums_.push_back({ valuePointer(sum), first_source, static_cast<int>(sources.size()) });
+            }
+            current.num_sums = static_cast<int>(sums_.size()) - current.first_sum;
+
+            if (current.processor && !current.processor->usesAudioBlocks()) {
+                current.legacy_bridge.prepare(current.num_inputs, current.num_outputs, max_frames_);
+            }
+        }
+
+        for (int channel = 0; channel < num_outputs_; ++channel) {
+            const std::vector<const Edge*> sources = sourcesOf(GRAPH_OUTPUT_NODE, channel);
+            graph_output_sources_.push_back(static_cast<int>(source_table_.size()));
+            graph_output_sources_.push_back(static_cast<int>(sources.size()));
+            for (const Edge* edge : sources) appendSource(*edge);
+        }
+
+        SYNTRI_LOG_INFO("Processing graph compiled: %d nodes in %d levels, %d pool channels for %d intermediate channels",
+            node_count, num_levels, pool_channels_, intermediate_channels_);
+        compiled_ = true;
+        return true;
+    }
+
+    // ====================================
+    // Execution
+    // ====================================
+    void ProcessingGraph::sumInto(AudioSample* destination, int first_source, int num_sources, int frames) const {
+        if (num_sources == 0) {
+            Kernels::clear(destination, frames);
+            return;
+        }
+        Kernels::copy(source_table_[static_cast<size_t>(first_source)], destination, frames);
+        for (int source = 1; source < num_sources; ++source) {
+            Kernels::mixAccumulate(source_table_[static_cast<size_t>(first_source + source)], destination, frames, 1.0f);
+        }
+    }
+
+    void ProcessingGraph::runNode(int node) {
+        Node& current = nodes_[static_cast<size_t>(node)];
+        TraceScope trace_scope("graph_node", node);
+        const int frames = block_frames_;
+
+        for (int sum = current.first_sum; sum < current.first_sum + current.num_sums; ++sum) {
+            const SumStep& step = sums_[static_cast<size_t>(sum)];
+            sumInto(step.destination, step.first_source, step.num_sources, frames);
+        }
+
+        const ConstAudioBlock inputs(source_table_.data() + current.input_table, current.num_inputs, frames);
+        const AudioBlock outputs(output_table_.data() + current.output_table, current.num_outputs, frames);
+        if (!current.processor) {
+            clearBlock(outputs);
+        }
+        else if (current.processor->usesAudioBlocks()) {
+            current.processor->processAudio(inputs, outputs);
+        }
+        else {
+            current.legacy_bridge.process(*current.processor, inputs, outputs);
+        }
+    }
+
+    void ProcessingGraph::runNodeTask(void* context, int task_index) {
+        ProcessingGraph& graph = *static_cast<ProcessingGraph*>(context);
+        graph.runNode(graph.levels_[static_cast<size_t>(graph.running_level_)][static_cast<size_t>(task_index)]);
+    }
+
+    void ProcessingGraph::processAudio(const ConstAudioBlock& inputs, const AudioBlock& outputs) {
+        const int frames = outputs.getNumFrames();
+        if (!compiled_ || frames > max_frames_) {
+            clearBlock(outputs);
+            return;
+        }
+        block_frames_ = frames;
+
+        // Host input channels move every callback
+        const AudioSample* silence = silence_.getBlock().getChannel(0);
+        for (const InputPatch& patch : input_patches_) {
+            source_table_[static_cast<size_t>(patch.entry)] =
+                patch.input_channel < inputs.getNumChannels() ? inputs.getChannel(patch.input_channel) : silence;
+        }
+
+        const bool parallel = worker_pool_ && worker_pool_->getNumWorkers() > 0;
+        for (size_t level = 0; level < levels_.size(); ++level) {
+            const std::vector<int>& level_nodes = levels_[level];
+            if (parallel && level_nodes.size() > 1) {
+                running_level_ = static_cast<int>(level);
+                worker_pool_->run(static_cast<int>(level_nodes.size()), runNodeTask, this);
+            }
+            else {
+                for (int node : level_nodes) runNode(node);
+            }
+        }
+
+        for (int channel = 0; channel < outputs.getNumChannels(); ++channel) {
+            if (channel < num_outputs_) {
+                sumInto(outputs.getChannel(channel), graph_output_sources_[static_cast<size_t>(2 * channel)],
+                    graph_output_sources_[static_cast<size_t>(2 * channel + 1)], frames);
+            }
+            else {
+                Kernels::clear(outputs.getChannel(channel), frames);
+            }
+        }
+    }
+
+    void ProcessingGraph::setupChanged(int sample_rate, int buffer_size) {
+        for (Node& node : nodes_) {
+            if (node.processor) node.processor->setupChanged(sample_rate, buffer_size);
+        }
+        if (compiled_ && buffer_size > max_frames_) {
+            compile(buffer_size);
+        }
+    }
+
+} // namespace Syntri
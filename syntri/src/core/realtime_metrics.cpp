@@ -0,0 +1,290 @@
+// src/core/realtime_metrics.cpp
+// Histogram bucketing, seqlock publication and percentile summaries
+
+#include "syntri/realtime_metrics.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Syntri {
+
+    namespace {
+        int highestBit(std::uint64_t value) {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanReverse64(&index, value);
+            return static_cast<int>(index);
+#else
+            return 63 - __builtin_clzll(value);
+#endif
+        }
+
+        PercentileSummary summarize(const HistogramSnapshot& histogram, double scale) {
+            PercentileSummary summary;
+            if (histogram.count == 0) return summary;
+            summary.mean = histogram.mean() * scale;
+            summary.p50 = histogram.percentile(0.50) * scale;
+            summary.p99 = histogram.percentile(0.99) * scale;
+            summary.p999 = histogram.percentile(0.999) * scale;
+            summary.max = histogram.max * scale;
+            return summary;
+        }
+    }
+
+    // ====================================
+    // Bucketing
+    // ====================================
+    int histogramBucketIndex(std::uint64_t value) {
+        if (value < static_cast<std::uint64_t>(HISTOGRAM_SUB_BUCKETS)) {
+            return static_cast<int>(value);
+        }
+
+        int exponent = highestBit(value);
+        if (exponent > HISTOGRAM_MAX_EXPONENT) {
+            return HISTOGRAM_BUCKET_COUNT - 1;
+        }
+
+        int sub_bucket = static_cast<int>((value >> (exponent - HISTOGRAM_SUB_BUCKET_BITS)) & (HISTOGRAM_SUB_BUCKETS - 1));
+        return (exponent - HISTOGRAM_SUB_BUCKET_BITS + 1) * HISTOGRAM_SUB_BUCKETS + sub_bucket;
+    }
+
+    std::uint64_t histogramBucketUpperBound(int index) {
+        if (index < HISTOGRAM_SUB_BUCKETS) {
+            return static_cast<std::uint64_t>(index);
+        }
+
+        int exponent = index / HISTOGRAM_SUB_BUCKETS + HISTOGRAM_SUB_BUCKET_BITS - 1;
+        std::uint64_t sub_bucket = static_cast<std::uint64_t>(index % HISTOGRAM_SUB_BUCKETS);
+        int shift = exponent - HISTOGRAM_SUB_BUCKET_BITS;
+        return ((HISTOGRAM_SUB_BUCKETS + sub_bucket + 1) << shift) - 1;
+    }
+
+    // ====================================
+    // HistogramSnapshot
+    // ====================================
+    std::uint64_t HistogramSnapshot::percentile(double q) const {
+        if (count == 0) return 0;
+
+        q = std::min(std::max(q, 0.0), 1.0);
+        std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count)));
+        rank = std::max<std::uint64_t>(rank, 1);
+
+        std::uint64_t seen = 0;
+        for (int i = 0; i < HISTOGRAM_BUCKET_COUNT; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return std::min(histogramBucketUpperBound(i), max);
+            }
+        }
+        return max;
+    }
+
+    double HistogramSnapshot::mean() const {
+        return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+
+    HistogramSnapshot HistogramSnapshot::difference(const HistogramSnapshot& newer, const HistogramSnapshot& older) {
+        HistogramSnapshot result;
+        for (int i = 0; i < HISTOGRAM_BUCKET_COUNT; ++i) {
+            result.buckets[i] = newer.buckets[i] - std::min(newer.buckets[i], older.buckets[i]);
+        }
+        result.count = newer.count - std::min(newer.count, older.count);
+        result.sum = newer.sum - std::min(newer.sum, older.sum);
+        result.max = newer.max;
+        return result;
+    }
+
+    // ====================================
+    // AtomicHistogram
+    // ====================================
+    AtomicHistogram::AtomicHistogram() {
+        reset();
+    }
+
+    void AtomicHistogram::copyTo(HistogramSnapshot& snapshot) const {
+        for (int i = 0; i < HISTOGRAM_BUCKET_COUNT; ++i) {
+            snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+        }
+        snapshot.count = count_.load(std::memory_order_relaxed);
+        snapshot.sum = sum_.load(std::memory_order_relaxed);
+        snapshot.max = max_.load(std::memory_order_relaxed);
+    }
+
+    void AtomicHistogram::reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    // ====================================
+    // RealtimeMetrics
+    // ====================================
+    RealtimeMetrics::RealtimeMetrics()
+        : sequence_(0), callback_count_(0), xrun_count_(0), period_ns_(0),
+        counter_mask_(0), counter_callbacks_(0) {
+        for (auto& total : counter_totals_) {
+            total.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void RealtimeMetrics::beginWrite() {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void RealtimeMetrics::endWrite() {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void RealtimeMetrics::reset() {
+        beginWrite();
+        callback_count_.store(0, std::memory_order_relaxed);
+        xrun_count_.store(0, std::memory_order_relaxed);
+        callback_duration_ns_.reset();
+        dsp_load_.reset();
+        wake_jitter_ns_.reset();
+        counter_mask_.store(0, std::memory_order_relaxed);
+        counter_callbacks_.store(0, std::memory_order_relaxed);
+        for (auto& total : counter_totals_) {
+            total.store(0, std::memory_order_relaxed);
+        }
+        endWrite();
+    }
+
+    void RealtimeMetrics::setPeriod(int sample_rate, int buffer_size) {
+        std::uint64_t period_ns = 0;
+        if (sample_rate > 0 && buffer_size > 0) {
+            period_ns = static_cast<std::uint64_t>(buffer_size) * 1000000000ULL / static_cast<std::uint64_t>(sample_rate);
+        }
+        period_ns_.store(period_ns, std::memory_order_relaxed);
+    }
+
+    void RealtimeMetrics::setHardwareCounterMask(std::uint32_t available_mask) {
+        counter_mask_.store(available_mask, std::memory_order_relaxed);
+    }
+
+    void RealtimeMetrics::recordCallback(std::uint64_t duration_ns, std::int64_t wake_jitter_ns) {
+        std::uint64_t period_ns = period_ns_.load(std::memory_order_relaxed);
+        std::uint64_t load = period_ns > 0 ? (duration_ns * 100 * DSP_LOAD_UNITS_PER_PERCENT) / period_ns : 0;
+
+        beginWrite();
+        callback_duration_ns_.record(duration_ns);
+        dsp_load_.record(load);
+        wake_jitter_ns_.record(wake_jitter_ns > 0 ? static_cast<std::uint64_t>(wake_jitter_ns) : 0);
+        callback_count_.store(callback_count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        endWrite();
+    }
+
+    void RealtimeMetrics::recordXrun() {
+        beginWrite();
+        xrun_count_.store(xrun_count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        endWrite();
+    }
+
+    void RealtimeMetrics::recordHardwareCounters(const PerfCounterValues& callback_counts) {
+        beginWrite();
+        for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+            counter_totals_[i].store(counter_totals_[i].load(std::memory_order_relaxed) + callback_counts.values[i],
+                std::memory_order_relaxed);
+        }
+        counter_callbacks_.store(counter_callbacks_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        endWrite();
+    }
+
+    void RealtimeMetrics::resetHardwareCounters() {
+        beginWrite();
+        for (auto& total : counter_totals_) {
+            total.store(0, std::memory_order_relaxed);
+        }
+        counter_callbacks_.store(0, std::memory_order_relaxed);
+        endWrite();
+    }
+
+    MetricsSnapshot RealtimeMetrics::snapshot() const {
+        MetricsSnapshot result;
+
+        // Retry until a copy lands entirely between two writes
+        while (true) {
+            std::uint32_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1u) {
+                continue;
+            }
+
+            result.callback_count = callback_count_.load(std::memory_order_relaxed);
+            result.xrun_count = xrun_count_.load(std::memory_order_relaxed);
+            callback_duration_ns_.copyTo(result.callback_duration_ns);
+            dsp_load_.copyTo(result.dsp_load);
+            wake_jitter_ns_.copyTo(result.wake_jitter_ns);
+            result.hardware_counters.callbacks = counter_callbacks_.load(std::memory_order_relaxed);
+            for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+                result.hardware_counters.totals.values[i] = counter_totals_[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+
+        result.period_ms = period_ns_.load(std::memory_order_relaxed) / 1.0e6;
+        result.hardware_counters.available_mask = counter_mask_.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    // ====================================
+    // HardwareCounterSummary
+    // ====================================
+    double HardwareCounterSummary::perCallback(PerfCounter counter) const {
+        return callbacks > 0 ? static_cast<double>(totals[counter]) / static_cast<double>(callbacks) : 0.0;
+    }
+
+    double HardwareCounterSummary::instructionsPerCycle() const {
+        const std::uint64_t cycles = totals[PerfCounter::CYCLES];
+        return cycles > 0 ? static_cast<double>(totals[PerfCounter::INSTRUCTIONS]) / static_cast<double>(cycles) : 0.0;
+    }
+
+    double HardwareCounterSummary::missesPerKiloInstruction(PerfCounter counter) const {
+        const std::uint64_t instructions = totals[PerfCounter::INSTRUCTIONS];
+        return instructions > 0 ? 1000.0 * static_cast<double>(totals[counter]) / static_cast<double>(instructions) : 0.0;
+    }
+
+    // ====================================
+    // MetricsSnapshot summaries
+    // ====================================
+    PercentileSummary MetricsSnapshot::callbackDurationMs() const {
+        return summarize(callback_duration_ns, 1.0e-6);
+    }
+
+    PercentileSummary MetricsSnapshot::dspLoadPercent() const {
+        return summarize(dsp_load, 1.0 / DSP_LOAD_UNITS_PER_PERCENT);
+    }
+
+    PercentileSummary MetricsSnapshot::wakeJitterMs() const {
+        return summarize(wake_jitter_ns, 1.0e-6);
+    }
+
+    SimpleMetrics MetricsSnapshot::toSimpleMetrics(double latency_ms) const {
+        PercentileSummary duration = callbackDurationMs();
+        PercentileSummary jitter = wakeJitterMs();
+
+        SimpleMetrics metrics;
+        metrics.latency_ms = latency_ms;
+        metrics.buffer_underruns = static_cast<int>(xrun_count);
+        metrics.callback_count = static_cast<long long>(callback_count);
+        metrics.processing_time_ms = duration.mean;
+        metrics.max_processing_time_ms = duration.max;
+        metrics.jitter_ms = jitter.mean;
+        metrics.max_jitter_ms = jitter.max;
+
+        // CPU usage: share of the buffer period spent inside processAudio
+        metrics.cpu_usage_percent = dspLoadPercent().mean;
+        return metrics;
+    }
+
+} // namespace Syntri
@@ -0,0 +1,144 @@
+// src/core/rt_safety.cpp
+// Callback scope tracking and violation reporting for the real-time safety checker
+
+#include "syntri/rt_safety.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#include <unistd.h>
+#define SYNTRI_HAS_BACKTRACE 1
+#endif
+
+namespace Syntri {
+
+    namespace {
+        // Plain thread-locals with constant initializers: no allocation, no
+        // guard variables, safe to read from inside malloc
+        thread_local int callback_depth = 0;
+        thread_local int exemption_depth = 0;
+        thread_local bool reporting = false;
+
+        std::atomic<bool> checks_installed{ false };
+        std::atomic<long long> violation_count{ 0 };
+        std::atomic<int> reports_printed{ 0 };
+        std::atomic<const char*> last_violation{ "" };
+
+        RealtimeViolationAction initialAction() {
+            const char* value = std::getenv("SYNTRI_RT_SAFETY_ABORT");
+            return (value && value[0] == '1') ? RealtimeViolationAction::ABORT : RealtimeViolationAction::REPORT;
+        }
+
+        std::atomic<RealtimeViolationAction>& violationAction() {
+            static std::atomic<RealtimeViolationAction> action{ initialAction() };
+            return action;
+        }
+
+        void writeReport(const char* function, long long count) {
+            char message[256];
+            int length = std::snprintf(message, sizeof(message),
+                "\n[Syntri RT safety] %s called inside an audio callback (violation #%lld)\n", function, count);
+#if defined(SYNTRI_HAS_BACKTRACE)
+            if (length > 0) {
+                ssize_t ignored = ::write(STDERR_FILENO, message, std::min<size_t>(length, sizeof(message) - 1));
+                (void)ignored;
+            }
+            void* frames[RT_SAFETY_BACKTRACE_DEPTH];
+            int depth = backtrace(frames, RT_SAFETY_BACKTRACE_DEPTH);
+            backtrace_symbols_fd(frames, depth, STDERR_FILENO);
+#else
+            (void)length;
+            std::fputs(message, stderr);
+#endif
+        }
+    }
+
+    // ====================================
+    // Scopes
+    // ====================================
+    RealtimeCallbackScope::RealtimeCallbackScope() {
+        ++callback_depth;
+    }
+
+    RealtimeCallbackScope::~RealtimeCallbackScope() {
+        --callback_depth;
+    }
+
+    RealtimeSafetyExemption::RealtimeSafetyExemption() {
+        ++exemption_depth;
+    }
+
+    RealtimeSafetyExemption::~RealtimeSafetyExemption() {
+        --exemption_depth;
+    }
+
+    bool isInRealtimeCallback() {
+        return callback_depth > 0 && exemption_depth == 0 && !reporting;
+    }
+
+    // ====================================
+    // Configuration & Results
+    // ====================================
+    bool realtimeSafetyChecksInstalled() {
+        return checks_installed.load(std::memory_order_relaxed);
+    }
+
+    void setRealtimeViolationAction(RealtimeViolationAction action) {
+        violationAction().store(action, std::memory_order_relaxed);
+    }
+
+    RealtimeViolationAction getRealtimeViolationAction() {
+        return violationAction().load(std::memory_order_relaxed);
+    }
+
+    long long getRealtimeViolationCount() {
+        return violation_count.load(std::memory_order_relaxed);
+    }
+
+    void resetRealtimeViolationCount() {
+        violation_count.store(0, std::memory_order_relaxed);
+        reports_printed.store(0, std::memory_order_relaxed);
+        last_violation.store("", std::memory_order_relaxed);
+    }
+
+    const char* getLastRealtimeViolation() {
+        return last_violation.load(std::memory_order_relaxed);
+    }
+
+    // ====================================
+    // Interposer Hooks
+    // ====================================
+    namespace detail {
+        void markRealtimeSafetyChecksInstalled() {
+            checks_installed.store(true, std::memory_order_relaxed);
+            violationAction();
+#if defined(SYNTRI_HAS_BACKTRACE)
+            // backtrace() loads libgcc and allocates on first use - do that now
+            void* frame;
+            backtrace(&frame, 1);
+#endif
+        }
+
+        void reportRealtimeViolation(const char* function) {
+            // Anything the report itself calls must pass straight through
+            reporting = true;
+
+            long long count = violation_count.fetch_add(1, std::memory_order_relaxed) + 1;
+            last_violation.store(function, std::memory_order_relaxed);
+
+            const bool abort_now = violationAction().load(std::memory_order_relaxed) == RealtimeViolationAction::ABORT;
+            if (abort_now || reports_printed.fetch_add(1, std::memory_order_relaxed) < RT_SAFETY_MAX_REPORTS) {
+                writeReport(function, count);
+            }
+            if (abort_now) {
+                std::abort();
+            }
+
+            reporting = false;
+        }
+    }
+
+} // namespace Syntri
@@ -0,0 +1,181 @@
+// src/core/rt_safety_interpose.cpp
+// Interposers for the real-time safety checker (Linux / glibc, test builds only)
+//
+// Linking this object into an executable replaces malloc & co., pthread_mutex_lock
+// and the common blocking syscalls with wrappers that report any call made
+// inside a RealtimeCallbackScope, then forward to glibc. operator new/delete
+// are covered because libstdc++ implements them on top of malloc/free.
+//
+// Only calls that go through the PLT are seen: glibc-internal calls (e.g. the
+// write() behind fwrite/std::cout) bypass these wrappers.
+
+// The fortified inline wrappers for open/read would collide with the definitions below
+#undef _FORTIFY_SOURCE
+
+#include "syntri/rt_safety.h"
+#include <cerrno>
+
+#if defined(__GLIBC__)
+
+#include <cstdarg>
+#include <cstddef>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <time.h>
+
+extern "C" {
+    // glibc's allocator entry points, bypassing the public symbols we replace
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* pointer, size_t size);
+    void* __libc_memalign(size_t alignment, size_t size);
+    void __libc_free(void* pointer);
+}
+
+namespace {
+    using MutexLockFunction = int (*)(pthread_mutex_t*);
+    using OpenFunction = int (*)(const char*, int, ...);
+    using ReadFunction = ssize_t(*)(int, void*, size_t);
+    using WriteFunction = ssize_t(*)(int, const void*, size_t);
+    using NanosleepFunction = int (*)(const timespec*, timespec*);
+    using ClockNanosleepFunction = int (*)(clockid_t, int, const timespec*, timespec*);
+    using UsleepFunction = int (*)(useconds_t);
+
+    MutexLockFunction real_mutex_lock = nullptr;
+    OpenFunction real_open = nullptr;
+    ReadFunction real_read = nullptr;
+    WriteFunction real_write = nullptr;
+    NanosleepFunction real_nanosleep = nullptr;
+    ClockNanosleepFunction real_clock_nanosleep = nullptr;
+    UsleepFunction real_usleep = nullptr;
+
+    template <typename Function>
+    Function resolve(Function& slot, const char* name) {
+        if (!slot) {
+            slot = reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+        }
+        return slot;
+    }
+
+    inline void check(const char* function) {
+        if (Syntri::isInRealtimeCallback()) {
+            Syntri::detail::reportRealtimeViolation(function);
+        }
+    }
+
+    // Resolve everything before the first callback: dlsym itself allocates
+    __attribute__((constructor)) void installRealtimeSafetyChecks() {
+        resolve(real_mutex_lock, "pthread_mutex_lock");
+        resolve(real_open, "open");
+        resolve(real_read, "read");
+        resolve(real_write, "write");
+        resolve(real_nanosleep, "nanosleep");
+        resolve(real_clock_nanosleep, "clock_nanosleep");
+        resolve(real_usleep, "usleep");
+        Syntri::detail::markRealtimeSafetyChecksInstalled();
+    }
+}
+
+extern "C" {
+
+    // ====================================
+    // Allocation
+    // ====================================
+    void* malloc(size_t size) __THROW {
+        check("malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size) __THROW {
+        check("calloc");
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* pointer, size_t size) __THROW {
+        check("realloc");
+        return __libc_realloc(pointer, size);
+    }
+
+    void* memalign(size_t alignment, size_t size) __THROW {
+        check("memalign");
+        return __libc_memalign(alignment, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size) __THROW {
+        check("aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** result, size_t alignment, size_t size) __THROW {
+        check("posix_memalign");
+        if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) {
+            return EINVAL;
+        }
+        void* pointer = __libc_memalign(alignment, size);
+        if (!pointer) {
+            return ENOMEM;
+        }
+        *result = pointer;
+        return 0;
+    }
+
+    void free(void* pointer) __THROW {
+        if (pointer) {
+            check("free");
+        }
+        __libc_free(pointer);
+    }
+
+    // ====================================
+    // Locking
+    // ====================================
+    int pthread_mutex_lock(pthread_mutex_t* mutex) __THROWNL {
+        check("pthread_mutex_lock");
+        return resolve(real_mutex_lock, "pthread_mutex_lock")(mutex);
+    }
+
+    // ====================================
+    // Blocking Syscalls
+    // ====================================
+    int open(const char* path, int flags, ...) {
+        check("open");
+        mode_t mode = 0;
+        if (flags & (O_CREAT | O_TMPFILE)) {
+            va_list arguments;
+            va_start(arguments, flags);
+            mode = static_cast<mode_t>(va_arg(arguments, int));
+            va_end(arguments);
+        }
+        return resolve(real_open, "open")(path, flags, mode);
+    }
+
+    ssize_t read(int fd, void* buffer, size_t count) {
+        check("read");
+        return resolve(real_read, "read")(fd, buffer, count);
+    }
+
+    ssize_t write(int fd, const void* buffer, size_t count) {
+        check("write");
+        return resolve(real_write, "write")(fd, buffer, count);
+    }
+
+    int nanosleep(const timespec* duration, timespec* remaining) {
+        check("nanosleep");
+        return resolve(real_nanosleep, "nanosleep")(duration, remaining);
+    }
+
+    int clock_nanosleep(clockid_t clock, int flags, const timespec* request, timespec* remaining) {
+        check("clock_nanosleep");
+        return resolve(real_clock_nanosleep, "clock_nanosleep")(clock, flags, request, remaining);
+    }
+
+    int usleep(useconds_t microseconds) {
+        check("usleep");
+        return resolve(real_usleep, "usleep")(microseconds);
+    }
+
+}
+
+#endif // __GLIBC__
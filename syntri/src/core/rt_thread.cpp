@@ -0,0 +1,249 @@
+// src/core/rt_thread.cpp
+// Platform thread setup for audio and DSP worker threads
+
+#include "syntri/rt_thread.h"
+#include <algorithm>
+#include <mutex>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <xmmintrin.h>
+#define SYNTRI_HAS_MXCSR 1
+#endif
+
+#if defined(__linux__)
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace Syntri {
+
+    namespace {
+        // MXCSR flush-to-zero (bit 15) and denormals-are-zero (bit 6)
+        constexpr unsigned MXCSR_FTZ_DAZ = 0x8040;
+
+        // AArch64 FPCR flush-to-zero (covers inputs and outputs)
+        constexpr unsigned long long FPCR_FZ = 1ULL << 24;
+
+        void appendNote(std::string* notes, const std::string& note) {
+            if (!notes) return;
+            if (!notes->empty()) *notes += "; ";
+            *notes += note;
+        }
+
+        // Recurse one page at a time; the write after the call keeps each
+        // frame alive so the compiler cannot turn this into a loop
+        constexpr std::size_t STACK_PAGE = 4096;
+
+        void touchStack(std::size_t remaining) {
+            volatile unsigned char page[STACK_PAGE];
+            page[0] = 0;
+            page[STACK_PAGE - 1] = 0;
+            if (remaining > STACK_PAGE) {
+                touchStack(remaining - STACK_PAGE);
+            }
+            page[1] = page[0];
+        }
+
+        unsigned long long readFloatState() {
+#if defined(SYNTRI_HAS_MXCSR)
+            return _mm_getcsr();
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+            unsigned long long fpcr;
+            __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+            return fpcr;
+#else
+            return 0;
+#endif
+        }
+
+        void writeFloatState(unsigned long long state) {
+#if defined(SYNTRI_HAS_MXCSR)
+            _mm_setcsr(static_cast<unsigned>(state));
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+            __asm__ __volatile__("msr fpcr, %0" : : "r"(state));
+#else
+            (void)state;
+#endif
+        }
+    }
+
+    // ====================================
+    // Denormals
+    // ====================================
+    bool enableDenormalFlush() {
+#if defined(SYNTRI_HAS_MXCSR)
+        writeFloatState(readFloatState() | MXCSR_FTZ_DAZ);
+        return true;
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+        writeFloatState(readFloatState() | FPCR_FZ);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool denormalFlushEnabled() {
+#if defined(SYNTRI_HAS_MXCSR)
+        return (readFloatState() & MXCSR_FTZ_DAZ) == MXCSR_FTZ_DAZ;
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+        return (readFloatState() & FPCR_FZ) != 0;
+#else
+        return false;
+#endif
+    }
+
+    ScopedDenormalFlush::ScopedDenormalFlush()
+        : saved_state_(readFloatState()), restore_(enableDenormalFlush()) {
+    }
+
+    ScopedDenormalFlush::~ScopedDenormalFlush() {
+        if (restore_) {
+            writeFloatState(saved_state_);
+        }
+    }
+
+    // ====================================
+    // Scheduling
+    // ====================================
+    bool setCurrentThreadRealtimePriority(int priority, int* applied_priority, std::string* notes) {
+#if defined(__linux__)
+        sched_param param{};
+        param.sched_priority = std::min(std::max(priority, sched_get_priority_min(SCHED_FIFO)),
+            sched_get_priority_max(SCHED_FIFO));
+
+        int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (result == EPERM) {
+            // Unprivileged users may still have an rtprio allowance (limits.conf / systemd)
+            rlimit limit{};
+            if (getrlimit(RLIMIT_RTPRIO, &limit) == 0 && limit.rlim_cur > 0) {
+                param.sched_priority = std::min(param.sched_priority, static_cast<int>(limit.rlim_cur));
+                result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+            }
+        }
+        if (result != 0) {
+            appendNote(notes, "SCHED_FIFO not permitted (needs CAP_SYS_NICE or an rtprio limit)");
+            return false;
+        }
+        if (applied_priority) *applied_priority = param.sched_priority;
+        return true;
+#elif defined(_WIN32)
+        (void)priority;
+        if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL)) {
+            appendNote(notes, "THREAD_PRIORITY_TIME_CRITICAL refused");
+            return false;
+        }
+        if (applied_priority) *applied_priority = THREAD_PRIORITY_TIME_CRITICAL;
+        return true;
+#else
+        (void)priority;
+        (void)applied_priority;
+        appendNote(notes, "Real-time priority not supported on this platform");
+        return false;
+#endif
+    }
+
+    bool setCurrentThreadAffinity(const std::vector<int>& cpus) {
+        if (cpus.empty()) return false;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+        DWORD_PTR mask = 0;
+        for (int cpu : cpus) {
+            if (cpu >= 0 && cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) mask |= static_cast<DWORD_PTR>(1) << cpu;
+        }
+        return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#else
+        return false;
+#endif
+    }
+
+    // ====================================
+    // Memory
+    // ====================================
+    bool lockProcessMemory(std::string* notes) {
+        static std::once_flag once;
+        static bool locked = false;
+        static std::string lock_notes;
+
+        std::call_once(once, []() {
+#if defined(__linux__)
+            // With MCL_FUTURE every later allocation must fit under the limit,
+            // so a small unprivileged limit would turn into allocation failures
+            rlimit limit{};
+            if (geteuid() != 0 && getrlimit(RLIMIT_MEMLOCK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY) {
+                lock_notes = "RLIMIT_MEMLOCK is limited; not locking memory";
+                return;
+            }
+            if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+                lock_notes = "mlockall failed";
+                return;
+            }
+#if defined(__GLIBC__)
+            // Keep freed heap mapped so it never has to be faulted in again
+            mallopt(M_TRIM_THRESHOLD, -1);
+            mallopt(M_MMAP_MAX, 0);
+#endif
+            locked = true;
+#else
+            lock_notes = "Memory locking not supported on this platform";
+#endif
+        });
+
+        if (!locked) appendNote(notes, lock_notes);
+        return locked;
+    }
+
+    void prefaultStack(std::size_t bytes) {
+        if (bytes > 0) {
+            touchStack(bytes);
+        }
+    }
+
+    // ====================================
+    // All Together
+    // ====================================
+    RealtimeThreadStatus configureCurrentThreadForAudio(const RealtimeThreadOptions& options) {
+        RealtimeThreadStatus status;
+
+        if (options.flush_denormals) {
+            status.denormals_flushed = enableDenormalFlush();
+            if (!status.denormals_flushed) appendNote(&status.notes, "Denormal flushing not supported on this CPU");
+        }
+
+        if (!options.cpu_affinity.empty()) {
+            status.affinity_set = setCurrentThreadAffinity(options.cpu_affinity);
+            if (!status.affinity_set) appendNote(&status.notes, "CPU affinity refused");
+        }
+
+        // Lock before touching the stack so the pre-faulted pages stay resident
+        if (options.lock_memory) {
+            status.memory_locked = lockProcessMemory(&status.notes);
+        }
+        if (options.prefault_stack_bytes > 0) {
+            prefaultStack(options.prefault_stack_bytes);
+            status.stack_prefaulted = true;
+        }
+
+        if (options.use_realtime_priority) {
+            status.realtime_priority = setCurrentThreadRealtimePriority(options.priority, &status.priority, &status.notes);
+        }
+
+        status.configured = true;
+        return status;
+    }
+
+} // namespace Syntri
@@ -0,0 +1,320 @@
+// src/core/signal_generator.cpp
+// Block-based test signals without per-sample transcendental calls
+
+#define _USE_MATH_DEFINES  // Enable M_PI in MSVC
+#include <cmath>
+
+#include "syntri/signal_generator.h"
+#include "syntri/audio_kernels.h"
+#include <algorithm>
+
+namespace Syntri {
+
+    namespace {
+        constexpr double TWO_PI = 2.0 * M_PI;
+
+        // Chirp rotator chunk: the sweep phase is exact at every chunk start
+        constexpr int SWEEP_CHUNK_FRAMES = 32;
+
+        // Paul Kellet's refined pink filter, scaled to roughly unit peak
+        constexpr float PINK_OUTPUT_GAIN = 0.11f;
+
+        std::uint32_t nextNoise(std::uint32_t state) {
+            return state * 1664525u + 1013904223u;
+        }
+
+        // Top bits of the LCG as a float in [-1, 1)
+        float noiseToFloat(std::uint32_t state) {
+            return static_cast<float>(static_cast<std::int32_t>(state & 0xFFFFFF00u)) * (1.0f / 2147483648.0f);
+        }
+    }
+
+    SignalGenerator::SignalGenerator(const SignalSettings& settings)
+        : settings_(settings), sample_rate_(SAMPLE_RATE_96K) {
+        reset();
+    }
+
+    void SignalGenerator::setSettings(const SignalSettings& settings) {
+        const bool new_sequence = settings.type != settings_.type || settings.seed != settings_.seed;
+        settings_ = settings;
+        if (new_sequence) {
+            reset();
+        }
+        frames_since_sync_ = SIGNAL_RESYNC_FRAMES;  // Frequency may have changed
+    }
+
+    void SignalGenerator::setSampleRate(int sample_rate) {
+        sample_rate_ = std::max(sample_rate, 1);
+        frames_since_sync_ = SIGNAL_RESYNC_FRAMES;
+    }
+
+    void SignalGenerator::reset() {
+        phase_ = 0.0;
+        frames_since_sync_ = SIGNAL_RESYNC_FRAMES;
+        sweep_position_ = 0;
+        impulse_countdown_ = 0.0;
+
+        std::uint32_t state = settings_.seed;
+        for (int lane = 0; lane < SIGNAL_ROTATOR_LANES; ++lane) {
+            state = nextNoise(state ^ 0x9E3779B9u);
+            noise_state_[lane] = state;
+        }
+        std::fill(std::begin(pink_state_), std::end(pink_state_), 0.0f);
+    }
+
+    // ====================================
+    // Rendering
+    // ====================================
+    void SignalGenerator::render(AudioSample* destination, int num_samples) {
+        if (num_samples <= 0) return;
+
+        switch (settings_.type) {
+        case SignalType::SINE: renderSine(destination, num_samples); break;
+        case SignalType::LOG_SWEEP: renderSweep(destination, num_samples); break;
+        case SignalType::WHITE_NOISE:
+            renderWhite(destination, num_samples, static_cast<float>(settings_.amplitude));
+            break;
+        case SignalType::PINK_NOISE: renderPink(destination, num_samples); break;
+        case SignalType::IMPULSE_TRAIN: renderImpulses(destination, num_samples); break;
+        default: Kernels::clear(destination, num_samples); break;
+        }
+    }
+
+    void SignalGenerator::render(const AudioBlock& block) {
+        if (block.getNumChannels() == 0) return;
+
+        AudioSample* first = block.getChannel(0);
+        render(first, block.getNumFrames());
+        for (int ch = 1; ch < block.getNumChannels(); ++ch) {
+            Kernels::copy(first, block.getChannel(ch), block.getNumFrames());
+        }
+    }
+
+    // ====================================
+    // Sine - Parallel Rotators
+    // ====================================
+    void SignalGenerator::resyncSine() {
+        const double omega = TWO_PI * settings_.frequency / sample_rate_;
+        for (int lane = 0; lane < SIGNAL_ROTATOR_LANES; ++lane) {
+            lane_re_[lane] = static_cast<float>(std::cos(phase_ + lane * omega));
+            lane_im_[lane] = static_cast<float>(std::sin(phase_ + lane * omega));
+        }
+        step_re_ = static_cast<float>(std::cos(SIGNAL_ROTATOR_LANES * omega));
+        step_im_ = static_cast<float>(std::sin(SIGNAL_ROTATOR_LANES * omega));
+        frames_since_sync_ = 0;
+    }
+
+    // After using the first `samples_used` lanes of a group, shift so the
+    // lanes again hold the next SIGNAL_ROTATOR_LANES samples
+    void SignalGenerator::advanceLanes(int samples_used) {
+        float re[SIGNAL_ROTATOR_LANES];
+        float im[SIGNAL_ROTATOR_LANES];
+        for (int lane = 0; lane < SIGNAL_ROTATOR_LANES; ++lane) {
+            int source = lane + samples_used;
+            if (source < SIGNAL_ROTATOR_LANES) {
+                re[lane] = lane_re_[source];
+                im[lane] = lane_im_[source];
+            }
+            else {
+                source -= SIGNAL_ROTATOR_LANES;
+                re[lane] = lane_re_[source] * step_re_ - lane_im_[source] * step_im_;
+                im[lane] = lane_re_[source] * step_im_ + lane_im_[source] * step_re_;
+            }
+        }
+        std::copy(std::begin(re), std::end(re), std::begin(lane_re_));
+        std::copy(std::begin(im), std::end(im), std::begin(lane_im_));
+    }
+
+    void SignalGenerator::renderSine(AudioSample* destination, int num_samples) {
+        const double omega = TWO_PI * settings_.frequency / sample_rate_;
+        const float amplitude = static_cast<float>(settings_.amplitude);
+
+        int done = 0;
+        while (done < num_samples) {
+            if (frames_since_sync_ >= SIGNAL_RESYNC_FRAMES) {
+                resyncSine();
+            }
+            const int chunk = std::min(num_samples - done, SIGNAL_RESYNC_FRAMES - frames_since_sync_);
+            const int groups = chunk / SIGNAL_ROTATOR_LANES;
+            const int tail = chunk - groups * SIGNAL_ROTATOR_LANES;
+
+            float re[SIGNAL_ROTATOR_LANES];
+            float im[SIGNAL_ROTATOR_LANES];
+            std::copy(std::begin(lane_re_), std::end(lane_re_), std::begin(re));
+            std::copy(std::begin(lane_im_), std::end(lane_im_), std::begin(im));
+            const float step_re = step_re_;
+            const float step_im = step_im_;
+
+            AudioSample* out = destination + done;
+            for (int group = 0; group < groups; ++group) {
+                for (int lane = 0; lane < SIGNAL_ROTATOR_LANES; ++lane) {
+                    out[lane] = amplitude * im[lane];
+                    const float next_re = re[lane] * step_re - im[lane] * step_im;
+                    im[lane] = re[lane] * step_im + im[lane] * step_re;
+                    re[lane] = next_re;
+                }
+                out += SIGNAL_ROTATOR_LANES;
+            }
+
+            std::copy(std::begin(re), std::end(re), std::begin(lane_re_));
+            std::copy(std::begin(im), std::end(im), std::begin(lane_im_));
+            for (int lane = 0; lane < tail; ++lane) {
+                out[lane] = amplitude * lane_im_[lane];
+            }
+            if (tail > 0) {
+                advanceLanes(tail);
+            }
+
+            phase_ = std::fmod(phase_ + chunk * omega, TWO_PI);
+            frames_since_sync_ += chunk;
+            done += chunk;
+        }
+    }
+
+    // ====================================
+    // Log Sweep - Chirp Rotator
+    // ====================================
+    void SignalGenerator::renderSweep(AudioSample* destination, int num_samples) {
+        const double f0 = std::max(settings_.sweep_start_hz, 1.0e-3);
+        const double f1 = std::max(settings_.sweep_end_hz, 1.0e-3);
+        const long long length = std::max(static_cast<long long>(settings_.sweep_seconds * sample_rate_), 1LL);
+        const double log_ratio = std::log(f1 / f0);
+        const double rate = static_cast<double>(sample_rate_);
+        const double amplitude = settings_.amplitude;
+
+        // Closed-form phase of frame n: 2pi f0 T / ln(f1/f0) * (exp(n/N ln(f1/f0)) - 1)
+        auto phaseAt = [&](long long frame) {
+            const double t = frame / rate;
+            if (std::fabs(log_ratio) < 1.0e-12) return TWO_PI * f0 * t;
+            const double T = length / rate;
+            return TWO_PI * f0 * T / log_ratio * std::expm1(t / T * log_ratio);
+        };
+        auto omegaAt = [&](long long frame) {
+            return TWO_PI * f0 * std::exp(static_cast<double>(frame) / length * log_ratio) / rate;
+        };
+
+        int done = 0;
+        while (done < num_samples) {
+            if (sweep_position_ >= length) {
+                sweep_position_ = 0;
+            }
+            const int chunk = static_cast<int>(std::min<long long>(
+                { static_cast<long long>(num_samples - done), SWEEP_CHUNK_FRAMES, length - sweep_position_ }));
+
+            // z = amplitude * e^{i phase}, w = e^{i omega}, omega grows by alpha per sample
+            const double phase = std::fmod(phaseAt(sweep_position_), TWO_PI);
+            const double omega = omegaAt(sweep_position_);
+            const double alpha = omega * (log_ratio / length);
+            double z_re = amplitude * std::cos(phase);
+            double z_im = amplitude * std::sin(phase);
+            double w_re = std::cos(omega + 0.5 * alpha);
+            double w_im = std::sin(omega + 0.5 * alpha);
+            const double c_re = std::cos(alpha);
+            const double c_im = std::sin(alpha);
+
+            AudioSample* out = destination + done;
+            for (int sample = 0; sample < chunk; ++sample) {
+                out[sample] = static_cast<float>(z_im);
+                const double next_z_re = z_re * w_re - z_im * w_im;
+                z_im = z_re * w_im + z_im * w_re;
+                z_re = next_z_re;
+                const double next_w_re = w_re * c_re - w_im * c_im;
+                w_im = w_re * c_im + w_im * c_re;
+                w_re = next_w_re;
+            }
+
+            sweep_position_ += chunk;
+            done += chunk;
+        }
+    }
+
+    // ====================================
+    // Noise
+    // ====================================
+    void SignalGenerator::renderWhite(AudioSample* destination, int num_samples, float amplitude) {
+        std::uint32_t state[SIGNAL_ROTATOR_LANES];
+        std::copy(std::begin(noise_state_), std::end(noise_state_), std::begin(state));
+
+        int sample = 0;
+        for (; sample + SIGNAL_ROTATOR_LANES <= num_samples; sample += SIGNAL_ROTATOR_LANES) {
+            for (int lane = 0; lane < SIGNAL_ROTATOR_LANES; ++lane) {
+                state[lane] = nextNoise(state[lane]);
+                destination[sample + lane] = amplitude * noiseToFloat(state[lane]);
+            }
+        }
+        for (int lane = 0; sample < num_samples; ++sample, ++lane) {
+            state[lane] = nextNoise(state[lane]);
+            destination[sample] = amplitude * noiseToFloat(state[lane]);
+        }
+
+        std::copy(std::begin(state), std::end(state), std::begin(noise_state_));
+    }
+
+    void SignalGenerator::renderPink(AudioSample* destination, int num_samples) {
+        renderWhite(destination, num_samples, 1.0f);
+
+        const float gain = static_cast<float>(settings_.amplitude) * PINK_OUTPUT_GAIN;
+        float b0 = pink_state_[0], b1 = pink_state_[1], b2 = pink_state_[2], b3 = pink_state_[3];
+        float b4 = pink_state_[4], b5 = pink_state_[5], b6 = pink_state_[6];
+
+        for (int sample = 0; sample < num_samples; ++sample) {
+            const float white = destination[sample];
+            b0 = 0.99886f * b0 + white * 0.0555179f;
+            b1 = 0.99332f * b1 + white * 0.0750759f;
+            b2 = 0.96900f * b2 + white * 0.1538520f;
+            b3 = 0.86650f * b3 + white * 0.3104856f;
+            b4 = 0.55000f * b4 + white * 0.5329522f;
+            b5 = -0.7616f * b5 - white * 0.0168980f;
+            destination[sample] = gain * (b0 + b1 + b2 + b3 + b4 + b5 + b6 + white * 0.5362f);
+            b6 = white * 0.115926f;
+        }
+
+        pink_state_[0] = b0; pink_state_[1] = b1; pink_state_[2] = b2; pink_state_[3] = b3;
+        pink_state_[4] = b4; pink_state_[5] = b5; pink_state_[6] = b6;
+    }
+
+    // ====================================
+    // Impulse Train
+    // ====================================
+    void SignalGenerator::renderImpulses(AudioSample* destination, int num_samples) {
+        Kernels::clear(destination, num_samples);
+
+        const double interval = sample_rate_ / std::max(settings_.frequency, 1.0e-3);
+        const float amplitude = static_cast<float>(settings_.amplitude);
+        while (impulse_countdown_ < num_samples) {
+            destination[static_cast<int>(impulse_countdown_)] = amplitude;
+            impulse_countdown_ += interval;
+        }
+        impulse_countdown_ -= num_samples;
+    }
+
+    // ====================================
+    // Signal Processor
+    // ====================================
+    namespace {
+        class SignalProcessor : public AudioProcessor {
+        private:
+            SignalGenerator generator_;
+
+        public:
+            explicit SignalProcessor(const SignalSettings& settings) : generator_(settings) {}
+
+            using AudioProcessor::processAudio;
+
+            void processAudio(const ConstAudioBlock& /*inputs*/, const AudioBlock& outputs) override {
+                generator_.render(outputs);
+            }
+
+            bool usesAudioBlocks() const override { return true; }
+
+            void setupChanged(int sample_rate, int /*buffer_size*/) override {
+                generator_.setSampleRate(sample_rate);
+            }
+        };
+    }
+
+    std::unique_ptr<AudioProcessor> createSignalProcessor(const SignalSettings& settings) {
+        return std::make_unique<SignalProcessor>(settings);
+    }
+
+} // namespace Syntri
@@ -0,0 +1,534 @@
+// src/core/stub_interface.cpp
+// Stub driver - period loop, deadline checks, recovery output and fault injection
+
+#include "syntri/stub_interface.h"
+#include "syntri/audio_kernels.h"
+#include "syntri/clock.h"
+#include "syntri/log.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#define SYNTRI_CPU_RELAX() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define SYNTRI_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define SYNTRI_CPU_RELAX() ((void)0)
+#endif
+
+namespace Syntri {
+
+    namespace {
+        void applyRamp(const AudioBlock& block, float start_gain, float end_gain) {
+            for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+                Kernels::applyGainRamp(block.getChannel(ch), block.getNumFrames(), start_gain, end_gain);
+            }
+        }
+    }
+
+    StubAudioInterface::StubAudioInterface(const StubInterfaceOptions& options)
+        : options_(options), initialized_(false), streaming_(false), sample_rate_(SAMPLE_RATE_96K),
+        buffer_size_(BUFFER_SIZE_ULTRA_LOW), processor_(nullptr),
+        hardware_type_(HardwareType::GENERIC_ASIO), in_recovery_(false), fade_in_next_(false),
+        recovery_(options.recovery), switch_state_(SwitchState::IDLE),
+        active_processor_(nullptr), outgoing_processor_(nullptr), crossfade_frames_(0), crossfade_done_(0),
+        pending_processor_(nullptr), pending_crossfade_frames_(0), retired_processor_(nullptr),
+        hardware_counters_enabled_(false), injected_load_(0.0), pending_stall_ns_(0),
+        virtual_clock_(options.scheduler), virtual_now_ns_(0) {
+        // mlockall and the malloc tuning that comes with it are process-wide
+        // and permanent - a test double should not do that unasked
+        thread_options_.lock_memory = false;
+        SYNTRI_LOG_VERBOSE("Creating stub audio interface...");
+    }
+
+    StubAudioInterface::~StubAudioInterface() {
+        SYNTRI_LOG_VERBOSE("Destroying stub audio interface...");
+        if (streaming_) {
+            stopStreaming();
+        }
+        if (initialized_) {
+            shutdown();
+        }
+    }
+
+    void StubAudioInterface::StreamBuffers::allocate(int new_sample_rate, int new_buffer_size) {
+        sample_rate = new_sample_rate;
+        buffer_size = new_buffer_size;
+        input.allocate(STUB_CHANNEL_COUNT, buffer_size);
+        output.allocate(STUB_CHANNEL_COUNT, buffer_size);
+        legacy_bridge.prepare(STUB_CHANNEL_COUNT, STUB_CHANNEL_COUNT, buffer_size);
+        played.allocate(STUB_CHANNEL_COUNT, buffer_size);
+        last_good.allocate(STUB_CHANNEL_COUNT, buffer_size);
+        crossfade.allocate(STUB_CHANNEL_COUNT, buffer_size);
+    }
+
+    // ====================================
+    // Lifecycle
+    // ====================================
+    bool StubAudioInterface::initialize(int sample_rate, int buffer_size) {
+        SYNTRI_LOG_INFO("Initializing stub interface (SR: %d Hz, Buffer: %d)", sample_rate, buffer_size);
+
+        if (sample_rate <= 0 || buffer_size <= 0) {
+            SYNTRI_LOG_WARNING("Invalid stub configuration");
+            return false;
+        }
+
+        sample_rate_ = sample_rate;
+        buffer_size_ = buffer_size;
+        initialized_ = true;
+
+        SYNTRI_LOG_INFO("Stub interface initialized successfully");
+        return true;
+    }
+
+    void StubAudioInterface::shutdown() {
+        if (!initialized_) return;
+
+        SYNTRI_LOG_INFO("Shutting down stub interface...");
+        if (streaming_) {
+            stopStreaming();
+        }
+        initialized_ = false;
+        SYNTRI_LOG_INFO("Stub interface shutdown complete");
+    }
+
+    double StubAudioInterface::getCurrentLatency() const {
+        // Calculate theoretical latency based on buffer size and sample rate
+        return (static_cast<double>(buffer_size_) / static_cast<double>(sample_rate_)) * 1000.0;
+    }
+
+    // ====================================
+    // Streaming
+    // ====================================
+    bool StubAudioInterface::startStreaming(AudioProcessor* processor) {
+        if (!initialized_ || !processor) {
+            SYNTRI_LOG_WARNING("Cannot start streaming - not initialized or no processor");
+            return false;
+        }
+        if (streaming_) {
+            SYNTRI_LOG_WARNING("Cannot start streaming - already streaming");
+            return false;
+        }
+
+        processor_ = processor;
+        active_processor_ = processor;
+        outgoing_processor_ = nullptr;
+        pending_processor_.store(nullptr, std::memory_order_relaxed);
+        retired_processor_.store(nullptr, std::memory_order_relaxed);
+        SYNTRI_LOG_INFO("Starting stub streaming...");
+
+        // Allocate everything the callback touches before the thread starts
+        buffers_ = std::make_unique<StreamBuffers>();
+        buffers_->allocate(sample_rate_, buffer_size_);
+        pending_buffers_.reset();
+        in_recovery_ = false;
+        fade_in_next_ = false;
+        switch_state_.store(SwitchState::IDLE, std::memory_order_relaxed);
+
+        metrics_.reset();
+        metrics_.setPeriod(sample_rate_, buffer_size_);
+        {
+            std::lock_guard<std::mutex> lock(thread_status_mutex_);
+            thread_status_ = RealtimeThreadStatus();
+        }
+
+        // Notify processor of setup
+        processor_->setupChanged(sample_rate_, buffer_size_);
+
+        if (options_.virtual_time) {
+            openHardwareCounters();
+            virtual_clock_.start(sample_rate_, buffer_size_, 0);
+            virtual_now_ns_ = 0;
+            streaming_.store(true, std::memory_order_release);
+            SYNTRI_LOG_INFO("Stub streaming started in virtual time");
+            return true;
+        }
+
+        streaming_.store(true, std::memory_order_release);
+        audio_thread_ = std::thread(&StubAudioInterface::audioThreadMain, this);
+        SYNTRI_LOG_INFO("Stub streaming started successfully");
+
+        return true;
+    }
+
+    void StubAudioInterface::stopStreaming() {
+        // Waits out a reconfigure() or swapProcessor() in progress, so the
+        // thread is never joined under a half-finished handoff
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (!streaming_) return;
+
+        SYNTRI_LOG_INFO("Stopping stub streaming...");
+        streaming_.store(false, std::memory_order_release);
+        if (audio_thread_.joinable()) {
+            audio_thread_.join();
+        }
+        else {
+            counters_.close();
+        }
+        processor_ = nullptr;
+        SYNTRI_LOG_INFO("Stub streaming stopped");
+    }
+
+    void StubAudioInterface::audioThreadMain() {
+        RealtimeThreadStatus status = configureCurrentThreadForAudio(thread_options_);
+        {
+            std::lock_guard<std::mutex> lock(thread_status_mutex_);
+            thread_status_ = status;
+        }
+        registerLogThread();
+        setTraceThreadName("Stub audio thread");
+        if (!status.notes.empty()) {
+            SYNTRI_LOG_INFO("Stub audio thread: %s", status.notes.c_str());
+        }
+
+        openHardwareCounters();
+
+        PeriodScheduler scheduler(options_.scheduler);
+        scheduler.start(buffers_->sample_rate, buffers_->buffer_size);
+
+        while (streaming_.load(std::memory_order_acquire)) {
+            const PeriodWake wake = scheduler.waitForNextPeriod();
+            processPeriod(scheduler, wake);
+        }
+        counters_.close();
+    }
+
+    // Counters measure only the thread that opens them
+    void StubAudioInterface::openHardwareCounters() {
+        if (!hardware_counters_enabled_.load(std::memory_order_relaxed)) return;
+
+        std::string notes;
+        counters_.open(&notes);
+        metrics_.setHardwareCounterMask(counters_.availableMask());
+        if (!notes.empty()) {
+            SYNTRI_LOG_INFO("Stub hardware counters: %s", notes.c_str());
+        }
+    }
+
+    int StubAudioInterface::stepBuffers(int count) {
+        if (!options_.virtual_time || !streaming_.load(std::memory_order_acquire)) {
+            SYNTRI_LOG_WARNING("Cannot step buffers - not streaming in virtual time");
+            return 0;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            const PeriodWake wake = virtual_clock_.advance(virtual_now_ns_);
+            virtual_now_ns_ = std::max(virtual_now_ns_, virtual_clock_.deadlineNanoseconds(wake.period_index));
+            virtual_now_ns_ += static_cast<std::uint64_t>(processPeriod(virtual_clock_, wake));
+        }
+        return std::max(count, 0);
+    }
+
+    std::int64_t StubAudioInterface::processPeriod(PeriodScheduler& clock, const PeriodWake& wake) {
+        const bool virtual_time = options_.virtual_time;
+        const std::uint64_t wake_ticks = readClockTicks();
+        if (isTracing() && !virtual_time && wake.lateness_ns > 0) {
+            // How late we reached the boundary - the usual reason a buffer is late
+            recordTraceEvent("wake_latency", wake_ticks - nanosecondsToClockTicks(static_cast<std::uint64_t>(wake.lateness_ns)),
+                wake_ticks, static_cast<std::int32_t>(wake.period_index & 0x7FFFFFFF));
+        }
+
+        // The device had nothing new for the boundaries we slept through
+        for (long long skipped = 0; skipped < wake.skipped_periods; ++skipped) {
+            metrics_.recordXrun();
+            playRecovery();
+        }
+
+        // Configuration switch: swap to the preallocated buffers on this
+        // boundary, which becomes period 0 of the new grid
+        const SwitchState state = switch_state_.load(std::memory_order_acquire);
+        if (state == SwitchState::PARKED) {
+            playParkedSilence();
+            return 0;
+        }
+        if (state == SwitchState::READY) {
+            const std::uint64_t boundary_ns = clock.deadlineNanoseconds(wake.period_index);
+            buffers_.swap(pending_buffers_);
+            clock.start(buffers_->sample_rate, buffers_->buffer_size, boundary_ns);
+            metrics_.setPeriod(buffers_->sample_rate, buffers_->buffer_size);
+            in_recovery_ = false;
+            fade_in_next_ = true;
+            switch_state_.store(SwitchState::IDLE, std::memory_order_release);
+        }
+        const std::int64_t period_ns = clock.getPeriodNanoseconds();
+        StreamBuffers& buffers = *buffers_;
+
+        // The output is due one period after this boundary - what processors
+        // see as the callback deadline. Virtual time has no wall-clock one.
+        const std::uint64_t deadline_ticks = virtual_time ? 0
+            : wake_ticks - nanosecondsToClockTicks(static_cast<std::uint64_t>(std::max<std::int64_t>(wake.lateness_ns, 0))) +
+                nanosecondsToClockTicks(static_cast<std::uint64_t>(period_ns));
+
+        // Fault injection, inside the measured window but outside processAudio.
+        // Virtual time just charges it to the simulated clock.
+        std::int64_t simulated_ns = 0;
+        const std::int64_t stall_ns = pending_stall_ns_.exchange(0, std::memory_order_relaxed);
+        const double load = injected_load_.load(std::memory_order_relaxed);
+        if (virtual_time) {
+            simulated_ns = stall_ns + static_cast<std::int64_t>(load * period_ns);
+        }
+        else if (stall_ns > 0) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(stall_ns));
+        }
+        if (load > 0.0 && !virtual_time) {
+            const std::uint64_t load_ticks = nanosecondsToClockTicks(static_cast<std::uint64_t>(load * period_ns));
+            while (readClockTicks() - wake_ticks < load_ticks) {
+                SYNTRI_CPU_RELAX();
+            }
+        }
+
+        // Counter totals belong to one processor: they restart when a swap
+        // installs the next one, and crossfade periods that run both are skipped
+        PerfCounterValues counts_before;
+        if (counters_.isOpen()) counters_.read(counts_before);
+        AudioProcessor* const measured = active_processor_;
+        const bool active_only = runProcessors(buffers, deadline_ticks);
+        if (counters_.isOpen()) {
+            PerfCounterValues counts_after;
+            counters_.read(counts_after);
+            if (active_processor_ != measured) metrics_.resetHardwareCounters();
+            if (active_only) metrics_.recordHardwareCounters(PerfCounterValues::difference(counts_after, counts_before));
+        }
+        const std::uint64_t done_ticks = readClockTicks();
+
+        // The buffer is due at the next boundary. Virtual time charges and
+        // records simulated time only, so load and xruns do not depend on
+        // how busy the host happens to be.
+        const std::int64_t charged_ns = virtual_time ? simulated_ns
+            : static_cast<std::int64_t>(clockTicksToNanoseconds(done_ticks - wake_ticks));
+        const std::uint64_t duration_ns = static_cast<std::uint64_t>(charged_ns);
+        if (wake.lateness_ns + charged_ns > period_ns) {
+            metrics_.recordXrun();
+            playRecovery();
+        }
+        else {
+            deliverOutput(state == SwitchState::FADE_OUT);
+        }
+        if (state == SwitchState::FADE_OUT) {
+            switch_state_.store(SwitchState::PARKED, std::memory_order_release);
+        }
+        metrics_.recordCallback(duration_ns, wake.lateness_ns);
+        return charged_ns;
+    }
+
+    bool StubAudioInterface::runProcessors(StreamBuffers& buffers, std::uint64_t deadline_ticks) {
+        // A swap starts on a boundary, and only once the previous one has finished
+        if (!outgoing_processor_) {
+            AudioProcessor* next = pending_processor_.exchange(nullptr, std::memory_order_acquire);
+            if (next) {
+                outgoing_processor_ = active_processor_;
+                active_processor_ = next;
+                crossfade_frames_ = pending_crossfade_frames_.load(std::memory_order_relaxed);
+                crossfade_done_ = 0;
+                if (crossfade_frames_ <= 0) {
+                    retired_processor_.store(outgoing_processor_, std::memory_order_release);
+                    outgoing_processor_ = nullptr;
+                }
+            }
+        }
+
+        const AudioBlock output = buffers.output.getBlock();
+        invokeProcessor(*active_processor_, buffers.legacy_bridge, buffers.input.getBlock(), output, deadline_ticks);
+        if (!outgoing_processor_) return true;
+
+        // Equal-gain crossfade over the first frames of this period still inside the fade
+        const AudioBlock old_output = buffers.crossfade.getBlock();
+        invokeProcessor(*outgoing_processor_, buffers.legacy_bridge, buffers.input.getBlock(), old_output, deadline_ticks);
+
+        const int frames = std::min(output.getNumFrames(), crossfade_frames_ - crossfade_done_);
+        const float start_gain = static_cast<float>(crossfade_done_) / crossfade_frames_;
+        const float end_gain = static_cast<float>(crossfade_done_ + frames) / crossfade_frames_;
+        for (int ch = 0; ch < output.getNumChannels(); ++ch) {
+            Kernels::applyGainRamp(output.getChannel(ch), frames, start_gain, end_gain);
+            Kernels::mixAccumulateRamp(old_output.getChannel(ch), output.getChannel(ch), frames,
+                1.0f - start_gain, 1.0f - end_gain);
+        }
+
+        crossfade_done_ += frames;
+        if (crossfade_done_ >= crossfade_frames_) {
+            // Last call into the old processor is behind us
+            retired_processor_.store(outgoing_processor_, std::memory_order_release);
+            outgoing_processor_ = nullptr;
+        }
+        return false;
+    }
+
+    // ====================================
+    // Simulated device output
+    // ====================================
+    void StubAudioInterface::deliverOutput(bool fade_out) {
+        const AudioBlock played = buffers_->played.getBlock();
+        copyBlock(buffers_->output.getBlock(), buffers_->last_good.getBlock());
+        copyBlock(buffers_->output.getBlock(), played);
+
+        if (fade_in_next_ || (in_recovery_ && recovery_.load(std::memory_order_relaxed) == XrunRecovery::CROSSFADE)) {
+            applyRamp(played, 0.0f, 1.0f);
+        }
+        else if (fade_out) {
+            applyRamp(played, 1.0f, 0.0f);
+        }
+        in_recovery_ = false;
+        fade_in_next_ = false;
+
+        if (options_.output_tap) options_.output_tap(played, false);
+    }
+
+    void StubAudioInterface::playRecovery() {
+        const AudioBlock played = buffers_->played.getBlock();
+        switch (recovery_.load(std::memory_order_relaxed)) {
+        case XrunRecovery::SILENCE:
+            clearBlock(played);
+            break;
+        case XrunRecovery::REPEAT_LAST:
+            copyBlock(buffers_->last_good.getBlock(), played);
+            break;
+        case XrunRecovery::CROSSFADE:
+            // Fade the last good buffer out once, then hold silence until fresh audio returns
+            if (in_recovery_) {
+                clearBlock(played);
+            }
+            else {
+                copyBlock(buffers_->last_good.getBlock(), played);
+                applyRamp(played, 1.0f, 0.0f);
+            }
+            break;
+        }
+        in_recovery_ = true;
+
+        if (options_.output_tap) options_.output_tap(played, true);
+    }
+
+    void StubAudioInterface::playParkedSilence() {
+        const AudioBlock played = buffers_->played.getBlock();
+        clearBlock(played);
+        if (options_.output_tap) options_.output_tap(played, false);
+    }
+
+    // ====================================
+    // Live reconfiguration and processor swaps
+    // ====================================
+    template <typename Done>
+    bool StubAudioInterface::waitForAudioThread(Done done) {
+        while (!done()) {
+            if (!streaming_.load(std::memory_order_acquire)) {
+                SYNTRI_LOG_WARNING("Stub control request abandoned - streaming stopped");
+                return false;
+            }
+            if (options_.virtual_time) {
+                stepBuffers(1);
+            }
+            else {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+        return true;
+    }
+
+    bool StubAudioInterface::reconfigure(int sample_rate, int buffer_size) {
+        if (!initialized_ || sample_rate <= 0 || buffer_size <= 0) {
+            SYNTRI_LOG_WARNING("Cannot reconfigure stub - not initialized or invalid configuration");
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (!streaming_.load(std::memory_order_acquire)) {
+            sample_rate_ = sample_rate;
+            buffer_size_ = buffer_size;
+            return true;
+        }
+        if (sample_rate == sample_rate_ && buffer_size == buffer_size_) return true;
+
+        SYNTRI_LOG_INFO("Reconfiguring stub stream (SR: %d Hz, Buffer: %d)", sample_rate, buffer_size);
+
+        // Allocate while the old configuration keeps playing
+        pending_buffers_ = std::make_unique<StreamBuffers>();
+        pending_buffers_->allocate(sample_rate, buffer_size);
+
+        switch_state_.store(SwitchState::FADE_OUT, std::memory_order_release);
+        if (!waitForAudioThread([this] { return switch_state_.load(std::memory_order_acquire) == SwitchState::PARKED; })) {
+            abandonSwitch();
+            return false;
+        }
+
+        // Nothing calls processAudio while parked, so this cannot race the callback
+        processor_->setupChanged(sample_rate, buffer_size);
+
+        switch_state_.store(SwitchState::READY, std::memory_order_release);
+        if (!waitForAudioThread([this] { return switch_state_.load(std::memory_order_acquire) == SwitchState::IDLE; })) {
+            abandonSwitch();
+            return false;
+        }
+
+        // The audio thread swapped pointers; the retired buffers are freed here
+        pending_buffers_.reset();
+        sample_rate_ = sample_rate;
+        buffer_size_ = buffer_size;
+        SYNTRI_LOG_INFO("Stub stream reconfigured");
+        return true;
+    }
+
+    // Leave no half-set switch behind for the next startStreaming()
+    void StubAudioInterface::abandonSwitch() {
+        switch_state_.store(SwitchState::IDLE, std::memory_order_release);
+        pending_buffers_.reset();
+    }
+
+    AudioProcessor* StubAudioInterface::swapProcessor(AudioProcessor* next, int crossfade_frames) {
+        if (!next || !streaming_.load(std::memory_order_acquire)) {
+            SYNTRI_LOG_WARNING("Cannot swap processor - not streaming or no processor");
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        AudioProcessor* old = processor_;
+        if (next == old) return nullptr;
+
+        // Prepared here, before the audio thread can reach it
+        next->setupChanged(sample_rate_, buffer_size_);
+
+        retired_processor_.store(nullptr, std::memory_order_relaxed);
+        pending_crossfade_frames_.store(std::max(crossfade_frames, 0), std::memory_order_relaxed);
+        pending_processor_.store(next, std::memory_order_release);
+        processor_ = next;
+
+        // Grace period: over once the audio thread hands the old pointer back.
+        // Without the handoff there is no proof the old processor is idle, so
+        // the caller gets nothing to destroy.
+        const bool retired = waitForAudioThread([this, old] {
+            return retired_processor_.load(std::memory_order_acquire) == old;
+        });
+        pending_processor_.store(nullptr, std::memory_order_relaxed);
+        retired_processor_.store(nullptr, std::memory_order_relaxed);
+        return retired ? old : nullptr;
+    }
+
+    // ====================================
+    // Monitoring and fault injection
+    // ====================================
+    SimpleMetrics StubAudioInterface::getMetrics() const {
+        return metrics_.snapshot().toSimpleMetrics(getCurrentLatency());
+    }
+
+    RealtimeThreadStatus StubAudioInterface::getRealtimeThreadStatus() const {
+        std::lock_guard<std::mutex> lock(thread_status_mutex_);
+        return thread_status_;
+    }
+
+    void StubAudioInterface::setHardwareCountersEnabled(bool enabled) {
+        hardware_counters_enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    void StubAudioInterface::setInjectedLoad(double fraction_of_period) {
+        injected_load_.store(std::max(fraction_of_period, 0.0), std::memory_order_relaxed);
+    }
+
+    void StubAudioInterface::injectStall(std::int64_t nanoseconds) {
+        pending_stall_ns_.store(std::max<std::int64_t>(nanoseconds, 0), std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<StubAudioInterface> createStubInterface(const StubInterfaceOptions& options) {
+        return std::make_unique<StubAudioInterface>(options);
+    }
+
+} // namespace Syntri
@@ -0,0 +1,199 @@
+// src/core/trace.cpp
+// Trace ring buffer and Chrome trace-event export
+
+#include "syntri/trace.h"
+#include "syntri/command_queue.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace Syntri {
+
+    namespace detail {
+        std::atomic<bool> tracing_enabled{ false };
+    }
+
+    namespace {
+        // Per-slot seqlock: odd while a writer fills it, 2 * (index + 1) once
+        // complete, so a reader can tell a torn or stale slot from a good one
+        struct TraceSlot {
+            std::atomic<std::uint64_t> sequence{ 0 };
+            TraceEvent event;
+        };
+
+        struct TraceBuffer {
+            std::unique_ptr<TraceSlot[]> slots;
+            std::size_t mask;
+            alignas(COMMAND_QUEUE_ALIGNMENT) std::atomic<std::uint64_t> next{ 0 };
+            std::atomic<std::uint64_t> cleared_before{ 0 };
+
+            explicit TraceBuffer(std::size_t capacity)
+                : slots(new TraceSlot[detail::roundUpToPowerOfTwo(capacity)]),
+                mask(detail::roundUpToPowerOfTwo(capacity) - 1) {
+            }
+        };
+
+        std::atomic<TraceBuffer*> current_buffer{ nullptr };
+        std::mutex control_mutex;
+
+        // A writer may still hold a replaced buffer, so buffers live until exit
+        std::vector<std::unique_ptr<TraceBuffer>>& allBuffers() {
+            static std::vector<std::unique_ptr<TraceBuffer>> buffers;
+            return buffers;
+        }
+
+        std::atomic<int> next_thread_index{ 0 };
+        thread_local int trace_thread_index = -1;
+        char thread_names[TRACE_MAX_THREADS][TRACE_THREAD_NAME_SIZE];
+
+        std::uint32_t threadIndex() {
+            if (trace_thread_index < 0) {
+                trace_thread_index = next_thread_index.fetch_add(1, std::memory_order_relaxed);
+            }
+            return static_cast<std::uint32_t>(trace_thread_index);
+        }
+
+        void writeJsonString(std::ofstream& file, const char* text) {
+            file << '"';
+            for (const char* c = text; *c; ++c) {
+                if (*c == '"' || *c == '\\') file << '\\';
+                file << *c;
+            }
+            file << '"';
+        }
+    }
+
+    // ====================================
+    // Control
+    // ====================================
+    void startTracing(std::size_t capacity) {
+        std::lock_guard<std::mutex> lock(control_mutex);
+        TraceBuffer* buffer = current_buffer.load(std::memory_order_acquire);
+        if (!buffer || buffer->mask + 1 < detail::roundUpToPowerOfTwo(std::max<std::size_t>(capacity, 2))) {
+            allBuffers().emplace_back(new TraceBuffer(std::max<std::size_t>(capacity, 2)));
+            buffer = allBuffers().back().get();
+            current_buffer.store(buffer, std::memory_order_release);
+        }
+        buffer->cleared_before.store(buffer->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        threadIndex();
+        detail::tracing_enabled.store(true, std::memory_order_release);
+    }
+
+    void stopTracing() {
+        detail::tracing_enabled.store(false, std::memory_order_release);
+    }
+
+    void clearTrace() {
+        std::lock_guard<std::mutex> lock(control_mutex);
+        TraceBuffer* buffer = current_buffer.load(std::memory_order_acquire);
+        if (buffer) {
+            buffer->cleared_before.store(buffer->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    void setTraceThreadName(const char* name) {
+        std::uint32_t index = threadIndex();
+        if (index < static_cast<std::uint32_t>(TRACE_MAX_THREADS) && name) {
+            std::strncpy(thread_names[index], name, TRACE_THREAD_NAME_SIZE - 1);
+            thread_names[index][TRACE_THREAD_NAME_SIZE - 1] = '\0';
+        }
+    }
+
+    // ====================================
+    // Recording
+    // ====================================
+    // Slots hold raw ticks in start_ns/duration_ns; getTraceEvents() converts
+    void recordTraceEvent(const char* name, std::uint64_t start_ticks, std::uint64_t end_ticks, std::int32_t arg) {
+        TraceBuffer* buffer = current_buffer.load(std::memory_order_acquire);
+        if (!buffer || !isTracing()) return;
+
+        const std::uint64_t index = buffer->next.fetch_add(1, std::memory_order_relaxed);
+        TraceSlot& slot = buffer->slots[index & buffer->mask];
+
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.event.name = name;
+        slot.event.start_ns = start_ticks;
+        slot.event.duration_ns = end_ticks > start_ticks ? end_ticks - start_ticks : 0;
+        slot.event.thread_index = threadIndex();
+        slot.event.arg = arg;
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+    }
+
+    // ====================================
+    // Export
+    // ====================================
+    std::vector<TraceEvent> getTraceEvents() {
+        std::lock_guard<std::mutex> lock(control_mutex);
+        std::vector<TraceEvent> events;
+        TraceBuffer* buffer = current_buffer.load(std::memory_order_acquire);
+        if (!buffer) return events;
+
+        const std::uint64_t cleared_before = buffer->cleared_before.load(std::memory_order_relaxed);
+        events.reserve(buffer->mask + 1);
+        for (std::size_t i = 0; i <= buffer->mask; ++i) {
+            const TraceSlot& slot = buffer->slots[i];
+            const std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before == 0 || (before & 1) != 0 || before / 2 - 1 < cleared_before) continue;
+
+            TraceEvent event = slot.event;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != before) continue;    // Overwritten while copying
+
+            event.start_ns = clockTimestampToNanoseconds(event.start_ns);
+            event.duration_ns = clockTicksToNanoseconds(event.duration_ns);
+            events.push_back(event);
+        }
+
+        std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+            return a.start_ns < b.start_ns;
+        });
+        return events;
+    }
+
+    bool writeChromeTrace(const std::string& path, std::string& error) {
+        std::vector<TraceEvent> events = getTraceEvents();
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            error = "Cannot open " + path;
+            return false;
+        }
+
+        const std::uint64_t origin = events.empty() ? 0 : events.front().start_ns;
+        file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Syntri\"}}";
+
+        const int named_threads = std::min(next_thread_index.load(std::memory_order_relaxed), TRACE_MAX_THREADS);
+        for (int thread = 0; thread < named_threads; ++thread) {
+            if (thread_names[thread][0] == '\0') continue;
+            file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread << ",\"args\":{\"name\":";
+            writeJsonString(file, thread_names[thread]);
+            file << "}}";
+        }
+
+        file.setf(std::ios::fixed);
+        file.precision(3);
+        for (const TraceEvent& event : events) {
+            file << ",\n{\"name\":";
+            writeJsonString(file, event.name ? event.name : "?");
+            file << ",\"cat\":\"syntri\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread_index
+                << ",\"ts\":" << (event.start_ns - origin) / 1000.0
+                << ",\"dur\":" << event.duration_ns / 1000.0;
+            if (event.arg >= 0) {
+                file << ",\"args\":{\"index\":" << event.arg << "}";
+            }
+            file << "}";
+        }
+        file << "\n]}\n";
+
+        if (!file) {
+            error = "Write failed for " + path;
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Syntri
@@ -0,0 +1,264 @@
+// src/core/worker_pool.cpp
+// Work-stealing real-time worker pool
+
+#include "syntri/worker_pool.h"
+#include "syntri/trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#define SYNTRI_CPU_RELAX() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define SYNTRI_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define SYNTRI_CPU_RELAX() ((void)0)
+#endif
+
+namespace Syntri {
+
+    namespace {
+        constexpr std::uint64_t FIELD_MASK = (1ULL << 24) - 1;
+        constexpr int MAX_TASKS = static_cast<int>(FIELD_MASK);
+
+        std::uint64_t packRange(std::uint32_t tag, std::uint64_t begin, std::uint64_t end) {
+            return (static_cast<std::uint64_t>(tag & 0xFFFFu) << 48) | ((begin & FIELD_MASK) << 24) | (end & FIELD_MASK);
+        }
+
+        std::uint32_t rangeTag(std::uint64_t range) { return static_cast<std::uint32_t>(range >> 48); }
+        int rangeBegin(std::uint64_t range) { return static_cast<int>((range >> 24) & FIELD_MASK); }
+        int rangeEnd(std::uint64_t range) { return static_cast<int>(range & FIELD_MASK); }
+
+        // Spin with exponentially growing pause bursts
+        void backoff(int& burst) {
+            for (int i = 0; i < burst; ++i) {
+                SYNTRI_CPU_RELAX();
+            }
+            burst = std::min(burst * 2, 64);
+        }
+    }
+
+    std::vector<int> getIsolatedCpus() {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        // Format: "2-5,8,10-11"
+        std::ifstream file("/sys/devices/system/cpu/isolated");
+        std::string list;
+        if (!file || !std::getline(file, list)) return cpus;
+
+        std::stringstream stream(list);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (item.empty()) continue;
+            size_t dash = item.find('-');
+            try {
+                int first = std::stoi(item.substr(0, dash));
+                int last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+            }
+            catch (...) {
+                return std::vector<int>();
+            }
+        }
+#endif
+        return cpus;
+    }
+
+    // ====================================
+    // Lifecycle
+    // ====================================
+    RealtimeWorkerPool::RealtimeWorkerPool(const WorkerPoolOptions& options)
+        : num_workers_(options.num_workers),
+        spin_iterations_(std::max(options.spin_iterations, 1)),
+        thread_options_(options.thread_options),
+        park_after_ticks_(nanosecondsToClockTicks(
+            static_cast<std::uint64_t>(std::max(options.park_after_idle_ms, 0.0) * 1.0e6))),
+        batch_generation_(0), function_(nullptr), context_(nullptr), remaining_(0),
+        running_(true), parked_workers_(0), deadline_misses_(0) {
+        if (num_workers_ < 0) {
+            num_workers_ = std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0);
+        }
+
+        std::vector<int> cpus = options.cpu_affinity;
+        if (cpus.empty() && options.use_isolated_cpus) {
+            cpus = getIsolatedCpus();
+        }
+
+        slots_.reset(new Slot[num_workers_ + 1]);
+        threads_.reserve(num_workers_);
+        for (int worker = 0; worker < num_workers_; ++worker) {
+            int cpu = cpus.empty() ? -1 : cpus[worker % cpus.size()];
+            threads_.emplace_back(&RealtimeWorkerPool::workerMain, this, worker, cpu);
+        }
+    }
+
+    RealtimeWorkerPool::~RealtimeWorkerPool() {
+        running_.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(park_mutex_);
+        }
+        park_condition_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    // ====================================
+    // Task Ranges
+    // ====================================
+    bool RealtimeWorkerPool::takeOwn(int slot_index, std::uint32_t tag, int& task) {
+        std::atomic<std::uint64_t>& range = slots_[slot_index].range;
+        std::uint64_t current = range.load(std::memory_order_acquire);
+        while (rangeTag(current) == (tag & 0xFFFFu) && rangeBegin(current) < rangeEnd(current)) {
+            std::uint64_t taken = packRange(tag, rangeBegin(current) + 1, rangeEnd(current));
+            if (range.compare_exchange_weak(current, taken, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                task = rangeBegin(current);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool RealtimeWorkerPool::stealInto(int slot_index, std::uint32_t tag, int& task) {
+        const int participants = num_workers_ + 1;
+        for (int offset = 1; offset < participants; ++offset) {
+            int victim = (slot_index + offset) % participants;
+            std::atomic<std::uint64_t>& range = slots_[victim].range;
+            std::uint64_t current = range.load(std::memory_order_acquire);
+
+            while (rangeTag(current) == (tag & 0xFFFFu) && rangeBegin(current) < rangeEnd(current)) {
+                int begin = rangeBegin(current);
+                int end = rangeEnd(current);
+                int middle = begin + (end - begin) / 2;     // Victim keeps [begin, middle)
+
+                if (range.compare_exchange_weak(current, packRange(tag, begin, middle),
+                    std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    // Run the first stolen task now, publish the rest as our own range
+                    task = middle;
+                    slots_[slot_index].range.store(packRange(tag, middle + 1, end), std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void RealtimeWorkerPool::participate(int slot_index, std::uint32_t generation,
+        ParallelTaskFunction function, void* context) {
+        int task;
+        while (takeOwn(slot_index, generation, task) || stealInto(slot_index, generation, task)) {
+            TraceScope trace_scope("worker_task", task);
+            function(context, task);
+            remaining_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    // ====================================
+    // Audio Thread Entry
+    // ====================================
+    bool RealtimeWorkerPool::run(int num_tasks, ParallelTaskFunction function, void* context, std::uint64_t deadline_ticks) {
+        num_tasks = std::min(num_tasks, MAX_TASKS);
+        if (num_tasks <= 0 || !function) {
+            return true;
+        }
+
+        const int participants = num_workers_ + 1;
+        const std::uint32_t generation = batch_generation_.load(std::memory_order_relaxed) + 1;
+
+        // Even split; the caller's slot is last
+        for (int slot = 0; slot < participants; ++slot) {
+            std::uint64_t begin = static_cast<std::uint64_t>(num_tasks) * slot / participants;
+            std::uint64_t end = static_cast<std::uint64_t>(num_tasks) * (slot + 1) / participants;
+            slots_[slot].range.store(packRange(generation, begin, end), std::memory_order_relaxed);
+        }
+        function_.store(function, std::memory_order_relaxed);
+        context_.store(context, std::memory_order_relaxed);
+        remaining_.store(num_tasks, std::memory_order_relaxed);
+        batch_generation_.store(generation, std::memory_order_release);
+
+        // Only reached after a long idle stretch (e.g. stream restart)
+        if (parked_workers_.load(std::memory_order_acquire) > 0) {
+            park_condition_.notify_all();
+        }
+
+        participate(num_workers_, generation, function, context);
+
+        // Join: workers may still be finishing tasks they took
+        int spins = 0;
+        int burst = 1;
+        while (remaining_.load(std::memory_order_acquire) > 0) {
+            if (++spins < spin_iterations_) {
+                backoff(burst);
+            }
+            else {
+                std::this_thread::yield();  // A worker was preempted mid-task
+            }
+        }
+
+        if (readClockTicks() > deadline_ticks) {
+            deadline_misses_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    bool RealtimeWorkerPool::run(int num_tasks, ParallelTaskFunction function, void* context) {
+        return run(num_tasks, function, context, UINT64_MAX);
+    }
+
+    // ====================================
+    // Worker Threads
+    // ====================================
+    void RealtimeWorkerPool::workerMain(int worker_index, int cpu) {
+        RealtimeThreadOptions thread_options = thread_options_;
+        thread_options.cpu_affinity.clear();
+        if (cpu >= 0) thread_options.cpu_affinity.push_back(cpu);
+        configureCurrentThreadForAudio(thread_options);
+
+        char trace_name[TRACE_THREAD_NAME_SIZE];
+        std::snprintf(trace_name, sizeof(trace_name), "DSP worker %d", worker_index);
+        setTraceThreadName(trace_name);
+
+        std::uint32_t seen_generation = batch_generation_.load(std::memory_order_acquire);
+        std::uint64_t idle_since = readClockTicks();
+        int spins = 0;
+        int burst = 1;
+
+        while (running_.load(std::memory_order_acquire)) {
+            std::uint32_t generation = batch_generation_.load(std::memory_order_acquire);
+            if (generation != seen_generation) {
+                seen_generation = generation;
+                participate(worker_index, generation,
+                    function_.load(std::memory_order_relaxed), context_.load(std::memory_order_relaxed));
+                idle_since = readClockTicks();
+                spins = 0;
+                burst = 1;
+                continue;
+            }
+
+            if (++spins < spin_iterations_) {
+                backoff(burst);
+                continue;
+            }
+
+            if (readClockTicks() - idle_since < park_after_ticks_) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Long idle: sleep until the next batch (bounded in case a notify raced)
+            std::unique_lock<std::mutex> lock(park_mutex_);
+            parked_workers_.fetch_add(1, std::memory_order_acq_rel);
+            park_condition_.wait_for(lock, std::chrono::milliseconds(1), [&]() {
+                return !running_.load(std::memory_order_acquire) ||
+                    batch_generation_.load(std::memory_order_acquire) != seen_generation;
+            });
+            parked_workers_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+} // namespace Syntri
@@ -0,0 +1,98 @@
+// Syntri Adaptive Buffer Test - Buffer Size Controller Verification
+// Drives a virtual-time stub through overload, stalls and recovery and checks each ladder move
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/adaptive_buffer.h"
+#include "syntri/stub_interface.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <iostream>
+
+// Step a quarter second of audio between controller updates, like a UI timer
+static Syntri::AdaptiveBufferAction run(Syntri::StubAudioInterface& stub, Syntri::AdaptiveBufferController& controller,
+    double seconds, int& steps_up, int& steps_down) {
+    Syntri::AdaptiveBufferAction last = Syntri::AdaptiveBufferAction::HOLD;
+    for (double elapsed = 0.0; elapsed < seconds; elapsed += 0.25) {
+        stub.stepBuffers(48000 / 4 / controller.getBufferSize());
+        Syntri::AdaptiveBufferAction action = controller.update();
+        if (action == Syntri::AdaptiveBufferAction::STEP_UP) steps_up++;
+        if (action == Syntri::AdaptiveBufferAction::STEP_DOWN) steps_down++;
+        if (action != Syntri::AdaptiveBufferAction::HOLD) last = action;
+    }
+    return last;
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - ADAPTIVE BUFFER TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    DcProcessor processor(0.0f);
+
+    Syntri::StubInterfaceOptions stub_options;
+    stub_options.virtual_time = true;
+    Syntri::StubAudioInterface stub(stub_options);
+    stub.initialize(48000, 32);
+    stub.startStreaming(&processor);
+
+    Syntri::AdaptiveBufferOptions options;
+    options.stable_seconds = 5.0;
+    Syntri::AdaptiveBufferController controller(stub, 48000, 32, options);
+    int steps_up = 0;
+    int steps_down = 0;
+
+    // Test 1: Light load holds
+    std::cout << "🔧 Test 1: Light load" << std::endl;
+    stub.setInjectedLoad(0.3);
+    run(stub, controller, 3.0, steps_up, steps_down);
+    passed &= check(steps_up == 0 && steps_down == 0 && controller.getBufferSize() == 32, "Stays at 32 samples");
+    std::cout << std::endl;
+
+    // Test 2: Tail load steps up one size per window
+    std::cout << "🔧 Test 2: Heavy load" << std::endl;
+    stub.setInjectedLoad(0.9);
+    run(stub, controller, 2.0, steps_up, steps_down);
+    passed &= check(steps_up == 1 && controller.getBufferSize() == 64, "p99.9 over threshold moves to 64");
+    run(stub, controller, 3.0, steps_up, steps_down);
+    passed &= check(steps_up == 2 && controller.getBufferSize() == 128, "Still overloaded moves to 128");
+    run(stub, controller, 3.0, steps_up, steps_down);
+    passed &= check(steps_up == 2 && controller.getBufferSize() == 128, "Top of the ladder holds");
+    passed &= check(stub.getMetricsSnapshot().xrun_count == 0, "No dropouts while switching");
+    std::cout << std::endl;
+
+    // Test 3: Stable load steps back down after the stable window
+    std::cout << "🔧 Test 3: Recovery" << std::endl;
+    stub.setInjectedLoad(0.1);
+    run(stub, controller, 4.0, steps_up, steps_down);
+    passed &= check(steps_down == 0, "Waits for the stable window");
+    run(stub, controller, 6.0, steps_up, steps_down);
+    passed &= check(steps_down == 1 && controller.getBufferSize() == 64, "Steps down to 64");
+    run(stub, controller, 8.0, steps_up, steps_down);
+    passed &= check(steps_down == 2 && controller.getBufferSize() == 32, "Steps down to 32");
+    std::cout << std::endl;
+
+    // Test 4: A single xrun is judged at once
+    std::cout << "🔧 Test 4: Xrun" << std::endl;
+    stub.injectStall(2000000);
+    Syntri::AdaptiveBufferAction action = run(stub, controller, 0.25, steps_up, steps_down);
+    passed &= check(action == Syntri::AdaptiveBufferAction::STEP_UP && controller.getBufferSize() == 64,
+        "Deadline miss steps up without waiting for a full window");
+    passed &= check(controller.getStableSeconds() == 0.0, "Stable time starts over");
+    std::cout << std::endl;
+
+    stub.stopStreaming();
+
+    // Test 5: Starting size not on the ladder
+    std::cout << "🔧 Test 5: Ladder placement" << std::endl;
+    Syntri::AdaptiveBufferController unknown(stub, 48000, 100, options);
+    passed &= check(unknown.getBufferSize() == 128, "Off-ladder size starts at the next size up");
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+// Syntri Audio Block Test - Planar Buffer Verification
+// Checks slab alignment, block views and both processor callback flavours
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/audio_block.h"
+#include "syntri/audio_interface.h"
+#include "test_helpers.h"
+#include <iostream>
+#include <cstdint>
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - AUDIO BLOCK TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Slab layout
+    std::cout << "🔧 Test 1: Slab layout" << std::endl;
+    Syntri::AudioBlockStorage storage(64, Syntri::BUFFER_SIZE_ULTRA_LOW + 3);
+    Syntri::AudioBlock block = storage.getBlock();
+    bool aligned = true;
+    for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+        aligned &= (reinterpret_cast<std::uintptr_t>(block.getChannel(ch)) % Syntri::AUDIO_BLOCK_ALIGNMENT) == 0;
+    }
+    passed &= check(aligned, "Every channel starts on a cache line");
+    passed &= check(storage.getChannelStride() % 16 == 0 && storage.getChannelStride() >= block.getNumFrames(),
+        "Channel stride padded to whole cache lines");
+    passed &= check(block.getChannel(1) - block.getChannel(0) == storage.getChannelStride(),
+        "Channels are contiguous in one slab");
+    std::cout << std::endl;
+
+    // Test 2: Views
+    std::cout << "🔧 Test 2: Block views" << std::endl;
+    for (int sample = 0; sample < block.getNumFrames(); ++sample) {
+        block.getChannel(5)[sample] = static_cast<float>(sample);
+    }
+    Syntri::AudioBlock sub = block.getSubBlock(8, 4).getChannelRange(4, 2);
+    passed &= check(sub.getNumFrames() == 4 && sub.getNumChannels() == 2, "Sub-block dimensions");
+    passed &= check(sub.getChannel(1)[0] == 8.0f && sub.getChannel(1)[3] == 11.0f, "Sub-block addresses the right samples");
+    Syntri::ConstAudioBlock read_only = sub;
+    passed &= check(read_only.getChannel(1) == sub.getChannel(1), "Writable block converts to const block");
+    storage.clear();
+    passed &= check(block.getChannel(5)[10] == 0.0f, "clear() zeroes the slab");
+    std::cout << std::endl;
+
+    // Test 3: Callback bridging
+    std::cout << "🔧 Test 3: Callback bridging" << std::endl;
+    const int frames = Syntri::BUFFER_SIZE_ULTRA_LOW;
+    Syntri::AudioBlockStorage inputs(8, frames);
+    Syntri::AudioBlockStorage outputs(8, frames);
+    for (int ch = 0; ch < 8; ++ch) {
+        for (int sample = 0; sample < frames; ++sample) {
+            inputs.getBlock().getChannel(ch)[sample] = 1.0f;
+        }
+    }
+
+    LegacyGainProcessor legacy(2.0f);
+    Syntri::LegacyProcessorBridge bridge;
+    bridge.prepare(8, 8, frames);
+    Syntri::invokeProcessor(legacy, bridge, inputs.getBlock(), outputs.getBlock());
+    passed &= check(outputs.getBlock().getChannel(7)[frames - 1] == 2.0f, "Legacy processor runs on planar buffers");
+
+    GainProcessor planar(3.0f);
+    Syntri::invokeProcessor(planar, bridge, inputs.getBlock(), outputs.getBlock());
+    passed &= check(outputs.getBlock().getChannel(7)[frames - 1] == 3.0f, "Planar processor called directly");
+
+    Syntri::MultiChannelBuffer vector_in(8, Syntri::AudioBuffer(frames, 1.0f));
+    Syntri::MultiChannelBuffer vector_out(8, Syntri::AudioBuffer(frames, 0.0f));
+    Syntri::AudioProcessor& planar_base = planar;
+    planar_base.processAudio(vector_in, vector_out, frames);
+    passed &= check(vector_out[3][0] == 3.0f, "Vector callback forwards to planar overload");
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
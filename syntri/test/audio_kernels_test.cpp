@@ -0,0 +1,134 @@
+// Syntri Audio Kernels Test - SIMD Path Verification
+// Runs every kernel on every supported instruction set against a plain reference
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/audio_kernels.h"
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+using Syntri::Kernels::InstructionSet;
+
+namespace {
+    constexpr int MAX_LENGTH = 203;   // Odd, covers every tail size of every width
+    constexpr float TOLERANCE = 1.0e-5f;
+
+    float signal(int i, int salt) {
+        return std::sin(0.37f * static_cast<float>(i) + static_cast<float>(salt)) * 0.8f;
+    }
+
+    bool nearlyEqual(const std::vector<float>& a, const std::vector<float>& b) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (std::fabs(a[i] - b[i]) > TOLERANCE) return false;
+        }
+        return true;
+    }
+
+    // Runs one kernel at every length and source misalignment (offset 0..3)
+    template <typename Kernel, typename Reference>
+    bool verify(Kernel kernel, Reference reference) {
+        for (int offset = 0; offset < 4; ++offset) {
+            for (int n = 0; n <= MAX_LENGTH; n += (n < 40 ? 1 : 17)) {
+                std::vector<float> src(n + offset), a(n + offset), b(n + offset), expected_a, expected_b;
+                for (int i = 0; i < n + offset; ++i) {
+                    src[i] = signal(i, 1);
+                    a[i] = signal(i, 2);
+                    b[i] = signal(i, 3);
+                }
+                expected_a = a;
+                expected_b = b;
+                kernel(src.data() + offset, a.data() + offset, b.data() + offset, n);
+                reference(src.data() + offset, expected_a.data() + offset, expected_b.data() + offset, n);
+                if (!nearlyEqual(a, expected_a) || !nearlyEqual(b, expected_b)) return false;
+            }
+        }
+        return true;
+    }
+
+    bool check(bool condition, const std::string& description) {
+        std::cout << (condition ? "    ✅ " : "    ❌ ") << description << std::endl;
+        return condition;
+    }
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - AUDIO KERNELS TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << "Detected: " << Syntri::Kernels::instructionSetToString(Syntri::Kernels::detectInstructionSet()) << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    const InstructionSet all_paths[] = {
+        InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512
+    };
+
+    for (InstructionSet isa : all_paths) {
+        std::string name = Syntri::Kernels::instructionSetToString(isa);
+        if (!Syntri::Kernels::setActiveInstructionSet(isa)) {
+            std::cout << "🔧 " << name << ": not supported here, skipped" << std::endl << std::endl;
+            continue;
+        }
+        std::cout << "🔧 " << name << std::endl;
+
+        passed &= check(verify(
+            [](const float* s, float* a, float*, int n) { Syntri::Kernels::copy(s, a, n); },
+            [](const float* s, float* a, float*, int n) { for (int i = 0; i < n; ++i) a[i] = s[i]; }),
+            "copy");
+        passed &= check(verify(
+            [](const float*, float* a, float*, int n) { Syntri::Kernels::clear(a, n); },
+            [](const float*, float* a, float*, int n) { for (int i = 0; i < n; ++i) a[i] = 0.0f; }),
+            "clear");
+        passed &= check(verify(
+            [](const float* s, float* a, float*, int n) { Syntri::Kernels::copyWithGain(s, a, n, 0.5f); },
+            [](const float* s, float* a, float*, int n) { for (int i = 0; i < n; ++i) a[i] = s[i] * 0.5f; }),
+            "copyWithGain");
+        passed &= check(verify(
+            [](const float*, float* a, float*, int n) { Syntri::Kernels::applyGain(a, n, -1.5f); },
+            [](const float*, float* a, float*, int n) { for (int i = 0; i < n; ++i) a[i] *= -1.5f; }),
+            "applyGain");
+        passed &= check(verify(
+            [](const float*, float* a, float*, int n) { Syntri::Kernels::applyGainRamp(a, n, 1.0f, 0.25f); },
+            [](const float*, float* a, float*, int n) {
+                for (int i = 0; i < n; ++i) a[i] *= 1.0f + (0.25f - 1.0f) * static_cast<float>(i) / static_cast<float>(n);
+            }),
+            "applyGainRamp");
+        passed &= check(verify(
+            [](const float* s, float* a, float*, int n) { Syntri::Kernels::mixAccumulate(s, a, n, 0.7f); },
+            [](const float* s, float* a, float*, int n) { for (int i = 0; i < n; ++i) a[i] += s[i] * 0.7f; }),
+            "mixAccumulate");
+        passed &= check(verify(
+            [](const float* s, float* a, float*, int n) { Syntri::Kernels::mixAccumulateRamp(s, a, n, 0.0f, 1.0f); },
+            [](const float* s, float* a, float*, int n) {
+                for (int i = 0; i < n; ++i) a[i] += s[i] * (static_cast<float>(i) / static_cast<float>(n));
+            }),
+            "mixAccumulateRamp");
+        passed &= check(verify(
+            [](const float* s, float* a, float* b, int n) { Syntri::Kernels::panAccumulate(s, a, b, n, 0.3f, 0.9f); },
+            [](const float* s, float* a, float* b, int n) {
+                for (int i = 0; i < n; ++i) { a[i] += s[i] * 0.3f; b[i] += s[i] * 0.9f; }
+            }),
+            "panAccumulate");
+        passed &= check(verify(
+            [](const float* s, float* a, float* b, int n) {
+                Syntri::Kernels::panAccumulateRamp(s, a, b, n, 0.0f, 1.0f, 1.0f, 0.5f);
+            },
+            [](const float* s, float* a, float* b, int n) {
+                for (int i = 0; i < n; ++i) {
+                    float t = static_cast<float>(i) / static_cast<float>(n);
+                    a[i] += s[i] * t;
+                    b[i] += s[i] * (1.0f - 0.5f * t);
+                }
+            }),
+            "panAccumulateRamp");
+        std::cout << std::endl;
+    }
+
+    Syntri::Kernels::setActiveInstructionSet(Syntri::Kernels::detectInstructionSet());
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// Syntri Clock Test - Hot-Path Timestamp Verification
+// Checks source selection, monotonic reads, calibration accuracy and read overhead
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/clock.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - CLOCK TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Source
+    std::cout << "🔧 Test 1: Clock source" << std::endl;
+    {
+        const Syntri::ClockInfo& info = Syntri::getClockInfo();
+        std::cout << "  Source: " << Syntri::clockSourceName(info.source)
+            << " (" << info.ticks_per_second / 1.0e6 << " MHz)" << std::endl;
+        passed &= check(info.ticks_per_second >= 1.0e8, "Tick rate calibrated");
+        passed &= check(info.source == Syntri::ClockSource::TSC || info.ticks_per_second == 1.0e9,
+            "Fallback ticks are nanoseconds");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Monotonic
+    std::cout << "🔧 Test 2: Monotonic reads" << std::endl;
+    {
+        bool monotonic = true;
+        std::uint64_t previous = Syntri::readClockTicks();
+        for (int i = 0; i < 1000000; ++i) {
+            const std::uint64_t now = Syntri::readClockTicks();
+            monotonic &= now >= previous;
+            previous = now;
+        }
+        passed &= check(monotonic, "One million reads never go backwards");
+
+        const std::uint64_t first = Syntri::clockNanoseconds();
+        std::thread other([&]() {
+            passed &= check(Syntri::clockNanoseconds() >= first, "Timestamps agree across threads");
+        });
+        other.join();
+    }
+    std::cout << std::endl;
+
+    // Test 3: Conversion against steady_clock
+    std::cout << "🔧 Test 3: Calibration accuracy" << std::endl;
+    {
+        const auto steady_start = std::chrono::steady_clock::now();
+        const std::uint64_t tick_start = Syntri::readClockTicks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        const std::uint64_t tick_end = Syntri::readClockTicks();
+        const auto steady_end = std::chrono::steady_clock::now();
+
+        const double measured_ns = static_cast<double>(Syntri::clockTicksToNanoseconds(tick_end - tick_start));
+        const double reference_ns = std::chrono::duration<double, std::nano>(steady_end - steady_start).count();
+        std::cout << "  50 ms sleep: " << measured_ns / 1.0e6 << " ms by ticks, "
+            << reference_ns / 1.0e6 << " ms by steady_clock" << std::endl;
+        passed &= check(std::fabs(measured_ns - reference_ns) < reference_ns * 0.01 + 200000.0,
+            "Tick durations match steady_clock within 1%");
+
+        const std::uint64_t ns = 1234567;
+        const std::uint64_t round_trip = Syntri::clockTicksToNanoseconds(Syntri::nanosecondsToClockTicks(ns));
+        passed &= check(round_trip + 2 >= ns && round_trip <= ns + 2, "ns -> ticks -> ns round trip");
+
+        const std::uint64_t stamp = Syntri::readClockTicks();
+        const std::uint64_t step = Syntri::clockTimestampToNanoseconds(stamp + Syntri::nanosecondsToClockTicks(ns)) -
+            Syntri::clockTimestampToNanoseconds(stamp);
+        passed &= check(step + 2 >= ns && step <= ns + 2, "Timestamp conversion is linear");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Overhead
+    std::cout << "🔧 Test 4: Read overhead" << std::endl;
+    {
+        constexpr int READS = 1000000;
+        volatile std::uint64_t sink = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < READS; ++i) {
+            sink = Syntri::readClockTicks();
+        }
+        const double per_read_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / READS;
+        (void)sink;
+        std::cout << "  " << per_read_ns << " ns per read" << std::endl;
+        passed &= check(per_read_ns < 1000.0, "Reads are cheap");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+// Syntri Command Queue Test - Control-to-Audio Queue Verification
+// Checks SPSC/MPSC ordering, capacity limits and lossless concurrent posting
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/command_queue.h"
+#include "test_helpers.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct TestCommand {
+    int producer;
+    int sequence;
+};
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - COMMAND QUEUE TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Single producer queue
+    std::cout << "🔧 Test 1: SPSC ordering and capacity" << std::endl;
+    {
+        Syntri::SpscQueue<TestCommand> queue(6);
+        passed &= check(queue.capacity() == 8, "Capacity rounds up to a power of two");
+
+        int pushed = 0;
+        while (queue.push(TestCommand{ 0, pushed })) ++pushed;
+        passed &= check(pushed == 8, "Push fails once the queue is full");
+
+        bool ordered = true;
+        TestCommand command;
+        for (int i = 0; i < 8; ++i) ordered &= queue.pop(command) && command.sequence == i;
+        passed &= check(ordered && !queue.pop(command), "Items pop in FIFO order, then empty");
+
+        const int total = 20000;
+        bool in_order = true;
+        std::thread producer([&]() {
+            for (int i = 0; i < total; ++i) {
+                while (!queue.push(TestCommand{ 0, i })) std::this_thread::yield();
+            }
+        });
+        for (int expected = 0; expected < total; ) {
+            if (queue.pop(command)) {
+                in_order &= command.sequence == expected;
+                ++expected;
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        passed &= check(in_order, "20000 items cross threads in order");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Multiple producers
+    std::cout << "🔧 Test 2: MPSC with concurrent producers" << std::endl;
+    {
+        Syntri::MpscQueue<TestCommand> queue(64);
+        const int producers = 4;
+        const int per_producer = 5000;
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, p]() {
+                for (int i = 0; i < per_producer; ++i) {
+                    while (!queue.push(TestCommand{ p, i })) std::this_thread::yield();
+                }
+            });
+        }
+
+        std::vector<int> next(producers, 0);
+        bool per_producer_order = true;
+        TestCommand command;
+        for (int received = 0; received < producers * per_producer; ) {
+            if (queue.pop(command)) {
+                per_producer_order &= command.sequence == next[command.producer];
+                ++next[command.producer];
+                ++received;
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+        for (auto& thread : threads) thread.join();
+
+        bool complete = true;
+        for (int count : next) complete &= count == per_producer;
+        passed &= check(complete && !queue.pop(command), "No item lost or duplicated");
+        passed &= check(per_producer_order, "Each producer's items keep their order");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -4,60 +4,52 @@
 
 #include "syntri/types.h"
 #include "syntri/audio_interface.h"
+#include "syntri/stub_interface.h"
+#include "syntri/audio_kernels.h"
+#include "syntri/trace.h"
 #include <iostream>
 #include <chrono>
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <cstdint>
+#include <string>
 
-// Test processor for comprehensive testing
+// Test processor for comprehensive testing. Timing is captured by the tracer
+// (one "callback" span per buffer plus this processor's own stage), so the
+// callback never allocates and a late buffer can be inspected individually.
 class ComprehensiveTestProcessor : public Syntri::AudioProcessor {
 private:
-    std::chrono::high_resolution_clock::time_point start_time_;
-    std::chrono::high_resolution_clock::time_point last_callback_;
-    std::vector<double> latency_measurements_;
     int callback_count_;
-    bool measuring_;
     double target_latency_ms_;
 
 public:
     ComprehensiveTestProcessor()
-        : callback_count_(0), measuring_(false), target_latency_ms_(3.0) {
-        start_time_ = std::chrono::high_resolution_clock::now();
-        last_callback_ = start_time_;
+        : callback_count_(0), target_latency_ms_(3.0) {
     }
 
-    void processAudio(
-        const Syntri::MultiChannelBuffer& inputs,
-        Syntri::MultiChannelBuffer& outputs,
-        int num_samples
-    ) override {
-        auto now = std::chrono::high_resolution_clock::now();
-
-        if (measuring_ && callback_count_ > 0) {
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
-                now - last_callback_);
-            double latency_ms = duration.count() / 1000.0;
-            latency_measurements_.push_back(latency_ms);
-        }
+    using Syntri::AudioProcessor::processAudio;
 
-        last_callback_ = now;
+    void processAudio(const Syntri::ConstAudioBlock& inputs, const Syntri::AudioBlock& outputs) override {
+        Syntri::TraceScope stage("passthrough", callback_count_);
         callback_count_++;
 
         // Process audio (simple passthrough)
-        for (size_t ch = 0; ch < outputs.size(); ++ch) {
-            outputs[ch].resize(num_samples, 0.0f);
-            for (int sample = 0; sample < num_samples; ++sample) {
-                if (ch < inputs.size() && sample < static_cast<int>(inputs[ch].size())) {
-                    outputs[ch][sample] = inputs[ch][sample];
-                }
-                else {
-                    outputs[ch][sample] = 0.0f;
-                }
+        const int num_samples = outputs.getNumFrames();
+        for (int ch = 0; ch < outputs.getNumChannels(); ++ch) {
+            if (ch < inputs.getNumChannels()) {
+                Syntri::Kernels::copy(inputs.getChannel(ch), outputs.getChannel(ch), num_samples);
+            }
+            else {
+                Syntri::Kernels::clear(outputs.getChannel(ch), num_samples);
             }
         }
     }
 
+    bool usesAudioBlocks() const override {
+        return true;
+    }
+
     void setupChanged(int sample_rate, int buffer_size) override {
         std::cout << "   Processor setup: " << sample_rate << " Hz, " << buffer_size << " samples" << std::endl;
 
@@ -66,38 +58,7 @@ public:
         std::cout << "   Theoretical minimum latency: " << target_latency_ms_ << " ms" << std::endl;
     }
 
-    void startMeasuring() {
-        measuring_ = true;
-        latency_measurements_.clear();
-        callback_count_ = 0;
-    }
-
-    void stopMeasuring() {
-        measuring_ = false;
-    }
-
-    double getAverageLatency() const {
-        if (latency_measurements_.empty()) return 0.0;
-
-        double sum = 0.0;
-        for (double latency : latency_measurements_) {
-            sum += latency;
-        }
-        return sum / latency_measurements_.size();
-    }
-
-    double getMinLatency() const {
-        if (latency_measurements_.empty()) return 0.0;
-        return *std::min_element(latency_measurements_.begin(), latency_measurements_.end());
-    }
-
-    double getMaxLatency() const {
-        if (latency_measurements_.empty()) return 0.0;
-        return *std::max_element(latency_measurements_.begin(), latency_measurements_.end());
-    }
-
     int getCallbackCount() const { return callback_count_; }
-    size_t getMeasurementCount() const { return latency_measurements_.size(); }
     double getTheoreticalLatency() const { return target_latency_ms_; }
 
     bool isUltraLowLatency() const {
@@ -258,15 +219,24 @@ int main() {
 
             std::cout << "   Testing pipeline: " << sample_rate << " Hz, " << buffer_size << " samples" << std::endl;
 
-            auto pipeline_interface = Syntri::createAudioInterface(Syntri::HardwareType::GENERIC_ASIO);
+            Syntri::StubInterfaceOptions pipeline_options;
+            pipeline_options.virtual_time = true;
+            auto pipeline_interface = Syntri::createStubInterface(pipeline_options);
             if (pipeline_interface && pipeline_interface->initialize(sample_rate, buffer_size)) {
                 auto processor = Syntri::createTestProcessor(false);
 
                 if (pipeline_interface->startStreaming(processor.get())) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    // 100 ms of buffers in virtual time
+                    const int buffers = sample_rate / 10 / buffer_size;
+                    pipeline_interface->stepBuffers(buffers);
                     pipeline_interface->stopStreaming();
-                    std::cout << "     ✅ Pipeline test passed" << std::endl;
-                    pipeline_tests_passed++;
+                    if (pipeline_interface->getMetrics().callback_count == buffers) {
+                        std::cout << "     ✅ Pipeline test passed" << std::endl;
+                        pipeline_tests_passed++;
+                    }
+                    else {
+                        std::cout << "     ❌ Pipeline callbacks missing" << std::endl;
+                    }
                 }
                 else {
                     std::cout << "     ❌ Pipeline streaming failed" << std::endl;
@@ -289,8 +259,54 @@ int main() {
         }
         std::cout << std::endl;
 
-        // Test 6: Hardware Detection
-        std::cout << "Test 6: Hardware Detection System" << std::endl;
+        // Test 6: Callback Timeline Trace
+        std::cout << "Test 6: Callback Timeline Trace" << std::endl;
+        {
+            auto trace_interface = Syntri::createStubInterface();
+            ComprehensiveTestProcessor trace_processor;
+            Syntri::startTracing();
+
+            if (trace_interface->initialize(Syntri::SAMPLE_RATE_48K, Syntri::BUFFER_SIZE_LOW) &&
+                trace_interface->startStreaming(&trace_processor)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                trace_interface->stopStreaming();
+            }
+            Syntri::stopTracing();
+            trace_interface->shutdown();
+
+            // Per-buffer intervals straight from the timeline
+            std::vector<Syntri::TraceEvent> events = Syntri::getTraceEvents();
+            std::vector<double> intervals_ms;
+            std::uint64_t previous_start = 0;
+            int stages = 0;
+            for (const auto& event : events) {
+                if (std::string(event.name) == "passthrough") stages++;
+                if (std::string(event.name) != "callback") continue;
+                if (previous_start != 0) intervals_ms.push_back((event.start_ns - previous_start) / 1.0e6);
+                previous_start = event.start_ns;
+            }
+
+            std::string error;
+            bool written = Syntri::writeChromeTrace("comprehensive_trace.json", error);
+
+            if (!intervals_ms.empty() && stages == trace_processor.getCallbackCount() && written) {
+                std::cout << "   Callbacks traced: " << intervals_ms.size() + 1 << std::endl;
+                std::cout << "   Interval min/max: " << *std::min_element(intervals_ms.begin(), intervals_ms.end())
+                    << " / " << *std::max_element(intervals_ms.begin(), intervals_ms.end()) << " ms" << std::endl;
+                std::cout << "   Timeline written to comprehensive_trace.json (chrome://tracing, ui.perfetto.dev)" << std::endl;
+                test_results.push_back("✅ Callback tracing working");
+                std::cout << "✅ Callback timeline captured" << std::endl;
+            }
+            else {
+                test_results.push_back("❌ Callback tracing failed");
+                std::cout << "❌ Callback timeline incomplete " << error << std::endl;
+                all_tests_passed = false;
+            }
+        }
+        std::cout << std::endl;
+
+        // Test 7: Hardware Detection
+        std::cout << "Test 7: Hardware Detection System" << std::endl;
 
         auto detected_hardware = Syntri::detectAvailableHardware();
         std::cout << "   Detected " << detected_hardware.size() << " audio interface(s):" << std::endl;
@@ -0,0 +1,158 @@
+// Syntri Fixed Size Processor Test - Compile-Time Shape Dispatch Verification
+// Checks that deployed shapes reach their specialization, others fall back, and both agree
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/fixed_size_processor.h"
+#include "syntri/fused_stages.h"
+#include "test_helpers.h"
+#include <cmath>
+#include <iostream>
+
+// Gain of 0.5 that remembers which path ran
+class ShapeRecorder : public Syntri::FixedSizeProcessor<ShapeRecorder> {
+public:
+    int fixed_channels = 0;
+    int fixed_frames = 0;
+    int dynamic_calls = 0;
+
+    template <int Channels, int Frames>
+    void processFixed(const Syntri::ConstAudioBlock& inputs, const Syntri::AudioBlock& outputs) {
+        fixed_channels = Channels;
+        fixed_frames = Frames;
+        for (int ch = 0; ch < Channels; ++ch) {
+            for (int i = 0; i < Frames; ++i) outputs.getChannel(ch)[i] = inputs.getChannel(ch)[i] * 0.5f;
+        }
+    }
+
+    void processDynamic(const Syntri::ConstAudioBlock& inputs, const Syntri::AudioBlock& outputs) {
+        dynamic_calls++;
+        for (int ch = 0; ch < outputs.getNumChannels(); ++ch) {
+            for (int i = 0; i < outputs.getNumFrames(); ++i) {
+                outputs.getChannel(ch)[i] = ch < inputs.getNumChannels() ? inputs.getChannel(ch)[i] * 0.5f : 0.0f;
+            }
+        }
+    }
+
+    void setupChanged(int, int) override {}
+
+    void reset() {
+        fixed_channels = 0;
+        fixed_frames = 0;
+        dynamic_calls = 0;
+    }
+};
+
+// Input channel ch holds ch + 1
+static void render(Syntri::AudioProcessor& processor, Syntri::AudioBlockStorage& output,
+    int input_channels, int output_channels, int frames) {
+    Syntri::AudioBlockStorage input;
+    input.allocate(input_channels, frames);
+    for (int ch = 0; ch < input_channels; ++ch) {
+        std::fill_n(input.getBlock().getChannel(ch), frames, static_cast<float>(ch + 1));
+    }
+    output.allocate(output_channels, frames);
+    const Syntri::AudioBlockStorage& const_input = input;
+    processor.processAudio(const_input.getBlock(), output.getBlock());
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - FIXED SIZE PROCESSOR TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Every deployed shape has its own instantiation
+    std::cout << "🔧 Test 1: Fixed shapes" << std::endl;
+    {
+        ShapeRecorder processor;
+        int fixed_shapes = 0;
+        bool agrees = true;
+        bool all_correct = true;
+        for (int channels = 1; channels <= Syntri::MAX_AUDIO_CHANNELS; ++channels) {
+            for (int frames : { 16, 32, 48, 64, 128 }) {
+                processor.reset();
+                Syntri::AudioBlockStorage output;
+                render(processor, output, channels, channels, frames);
+                const bool fixed = processor.dynamic_calls == 0;
+                fixed_shapes += fixed ? 1 : 0;
+                agrees &= fixed == Syntri::isFixedShape(channels, frames) &&
+                    (!fixed || (processor.fixed_channels == channels && processor.fixed_frames == frames));
+                all_correct &= output.getBlock().getChannel(channels - 1)[frames - 1] == 0.5f * channels;
+            }
+        }
+        passed &= check(fixed_shapes == 6, "8/16/64 channels at 32/64 samples dispatch to processFixed");
+        passed &= check(agrees, "isFixedShape() matches the dispatch for every shape");
+        passed &= check(all_correct, "Specializations cover every channel and frame");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Everything else takes the generic path
+    std::cout << "🔧 Test 2: Fallback" << std::endl;
+    {
+        ShapeRecorder processor;
+        Syntri::AudioBlockStorage output;
+        render(processor, output, 16, 16, 48);
+        passed &= check(processor.dynamic_calls == 1 && processor.fixed_channels == 0, "Odd block size falls back");
+        processor.reset();
+        render(processor, output, 12, 12, 64);
+        passed &= check(processor.dynamic_calls == 1 && !Syntri::isFixedShape(12, 64), "Odd channel count falls back");
+        processor.reset();
+        render(processor, output, 2, 8, 32);
+        passed &= check(processor.dynamic_calls == 1, "Mismatched input and output counts fall back");
+        passed &= check(output.getBlock().getChannel(1)[0] == 1.0f && output.getBlock().getChannel(7)[0] == 0.0f,
+            "Fallback handles the mismatch");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Built-in test processor
+    std::cout << "🔧 Test 3: Test processor" << std::endl;
+    {
+        auto passthrough = Syntri::createTestProcessor(false);
+        Syntri::AudioBlockStorage fixed_output;
+        render(*passthrough, fixed_output, 64, 64, 64);
+        Syntri::AudioBlockStorage dynamic_output;
+        render(*passthrough, dynamic_output, 64, 64, 96);
+        passed &= check(fixed_output.getBlock().getChannel(63)[63] == 64.0f &&
+            dynamic_output.getBlock().getChannel(63)[95] == 64.0f, "Passthrough matches on both paths");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Fused stage chains specialize too
+    std::cout << "🔧 Test 4: Stage chain processor" << std::endl;
+    {
+        Syntri::FusedStageProcessor<Syntri::TrimStage, Syntri::PolarityStage, Syntri::PeakMeterStage> fixed;
+        Syntri::StageChain<Syntri::TrimStage, Syntri::PolarityStage, Syntri::PeakMeterStage> reference;
+        for (int ch = 0; ch < 16; ++ch) {
+            fixed.getChain().stage<Syntri::TrimStage>().setGain(ch, 0.1f * ch);
+            fixed.getChain().stage<Syntri::PolarityStage>().setInverted(ch, ch % 3 == 0);
+            reference.stage<Syntri::TrimStage>().setGain(ch, 0.1f * ch);
+            reference.stage<Syntri::PolarityStage>().setInverted(ch, ch % 3 == 0);
+        }
+
+        Syntri::AudioBlockStorage fixed_output;
+        render(fixed, fixed_output, 16, 16, 64);
+        Syntri::AudioBlockStorage reference_output;
+        render(*Syntri::createTestProcessor(false), reference_output, 16, 16, 64);
+        reference.process(reference_output.getBlock());
+
+        float difference = 0.0f;
+        for (int ch = 0; ch < 16; ++ch) {
+            for (int i = 0; i < 64; ++i) {
+                difference = std::max(difference, std::fabs(fixed_output.getBlock().getChannel(ch)[i] -
+                    reference_output.getBlock().getChannel(ch)[i]));
+            }
+        }
+        passed &= check(difference == 0.0f, "Fixed 16x64 chain matches the dynamic chain");
+        passed &= check(fixed.getChain().stage<Syntri::PeakMeterStage>().getPeak(15) ==
+            reference.stage<Syntri::PeakMeterStage>().getPeak(15), "Meters agree");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
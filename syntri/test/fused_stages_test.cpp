@@ -0,0 +1,155 @@
+// Syntri Fused Stages Test - Stage Chain Verification
+// Checks the fused loop against one pass per stage, and each stage's own behaviour
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/fused_stages.h"
+#include "test_helpers.h"
+#include <cmath>
+#include <iostream>
+
+// Deterministic noise in [-0.5, 0.5)
+static void fillNoise(const Syntri::AudioBlock& block, unsigned seed) {
+    for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+        for (int i = 0; i < block.getNumFrames(); ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            block.getChannel(ch)[i] = static_cast<float>(seed >> 8) / 16777216.0f - 0.5f;
+        }
+    }
+}
+
+static float maxDifference(const Syntri::AudioBlock& a, const Syntri::AudioBlock& b) {
+    float difference = 0.0f;
+    for (int ch = 0; ch < a.getNumChannels(); ++ch) {
+        for (int i = 0; i < a.getNumFrames(); ++i) {
+            difference = std::max(difference, std::fabs(a.getChannel(ch)[i] - b.getChannel(ch)[i]));
+        }
+    }
+    return difference;
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - FUSED STAGES TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Fused matches unfused
+    std::cout << "🔧 Test 1: Fused vs unfused" << std::endl;
+    {
+        Syntri::ChannelStripChain fused;
+        Syntri::ChannelStripChain unfused;
+        for (Syntri::ChannelStripChain* chain : { &fused, &unfused }) {
+            for (int ch = 0; ch < 16; ++ch) {
+                chain->stage<Syntri::TrimStage>().setGainDb(ch, -6.0f + ch);
+                chain->stage<Syntri::PolarityStage>().setInverted(ch, ch % 2 == 1);
+                chain->stage<Syntri::GainStage>().setGain(ch, 0.1f * ch);
+            }
+            for (int pair = 0; pair < 8; ++pair) {
+                chain->stage<Syntri::BalanceStage>().setBalance(pair, -1.0f + 0.25f * pair);
+            }
+        }
+
+        Syntri::AudioBlockStorage input;
+        Syntri::AudioBlockStorage fused_output;
+        Syntri::AudioBlockStorage unfused_output;
+        input.allocate(16, 64);
+        fused_output.allocate(16, 64);
+        unfused_output.allocate(16, 64);
+        fillNoise(input.getBlock(), 1234u);
+
+        fused.process(Syntri::ConstAudioBlock(input.getBlock()), fused_output.getBlock());
+        unfused.processUnfused(Syntri::ConstAudioBlock(input.getBlock()), unfused_output.getBlock());
+        passed &= check(maxDifference(fused_output.getBlock(), unfused_output.getBlock()) < 1.0e-6f,
+            "One loop per channel matches one pass per stage");
+
+        bool meters_match = true;
+        for (int ch = 0; ch < 16; ++ch) {
+            meters_match &= fused.stage<Syntri::PeakMeterStage>().getPeak(ch) ==
+                unfused.stage<Syntri::PeakMeterStage>().getPeak(ch);
+        }
+        passed &= check(meters_match, "Meters agree");
+
+        fused.process(input.getBlock());
+        passed &= check(maxDifference(input.getBlock(), fused_output.getBlock()) < 1.0e-6f, "In place matches");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Individual stages
+    std::cout << "🔧 Test 2: Stage behaviour" << std::endl;
+    {
+        Syntri::ChannelStripChain chain;
+        chain.stage<Syntri::TrimStage>().setGain(0, 2.0f);
+        chain.stage<Syntri::PolarityStage>().setInverted(1, true);
+        chain.stage<Syntri::GainStage>().setGainDb(2, -20.0f);
+        chain.stage<Syntri::BalanceStage>().setBalance(2, 1.0f);
+
+        Syntri::AudioBlockStorage block;
+        block.allocate(6, 32);
+        for (int ch = 0; ch < 6; ++ch) {
+            std::fill_n(block.getBlock().getChannel(ch), 32, 0.5f);
+        }
+        chain.process(block.getBlock());
+        const Syntri::AudioBlock out = block.getBlock();
+        passed &= check(out.getChannel(0)[31] == 1.0f, "Trim scales");
+        passed &= check(out.getChannel(1)[0] == -0.5f && chain.stage<Syntri::PolarityStage>().isInverted(1),
+            "Polarity inverts");
+        passed &= check(std::fabs(out.getChannel(2)[0] - 0.05f) < 1.0e-6f, "Fader in dB");
+        passed &= check(std::fabs(out.getChannel(4)[0]) < 1.0e-6f && out.getChannel(5)[0] == 0.5f,
+            "Hard-right balance silences the left channel");
+
+        Syntri::BalanceStage centre;
+        centre.setBalance(0, 0.0f);
+        passed &= check(centre.getGain(0) == 1.0f && centre.getGain(1) == 1.0f, "Centre balance is unity");
+        centre.setBalance(0, -0.5f);
+        passed &= check(centre.getGain(0) == 1.0f && std::fabs(centre.getGain(1) - std::sqrt(0.5f)) < 1.0e-5f,
+            "Half left keeps the near side and takes 3 dB off the far side");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Meters
+    std::cout << "🔧 Test 3: Peak meter" << std::endl;
+    {
+        Syntri::StageChain<Syntri::GainStage, Syntri::PeakMeterStage> chain;
+        chain.stage<0>().setGain(0, -2.0f);
+        Syntri::MultiChannelBuffer buffer(2, Syntri::AudioBuffer(64, 0.0f));
+        buffer[0][10] = 0.25f;
+        buffer[1][20] = -0.75f;
+        chain.process(buffer, 64);
+        passed &= check(buffer[0][10] == -0.5f, "MultiChannelBuffer runs in place");
+        passed &= check(chain.stage<1>().getPeak(0) == 0.5f && chain.stage<1>().getPeak(1) == 0.75f,
+            "Meter sees the post-fader peak");
+
+        buffer[0][10] = 0.1f;
+        chain.process(buffer, 64);
+        passed &= check(chain.stage<1>().getPeak(0) == 0.5f, "Peak holds until reset");
+        chain.stage<1>().resetPeaks();
+        buffer[0][10] = 0.1f;
+        buffer[1][20] = 0.0f;
+        chain.process(buffer, 64);
+        passed &= check(std::fabs(chain.stage<1>().getPeak(0) - 0.2f) < 1.0e-6f, "Reset starts over");
+    }
+    std::cout << std::endl;
+
+    // Test 4: As a processor
+    std::cout << "🔧 Test 4: Processor wrapper" << std::endl;
+    {
+        Syntri::FusedStageProcessor<Syntri::TrimStage, Syntri::PolarityStage> processor;
+        processor.getChain().stage<Syntri::TrimStage>().setGain(0, 0.5f);
+        processor.getChain().stage<Syntri::PolarityStage>().setInverted(0, true);
+
+        Syntri::MultiChannelBuffer inputs(1, Syntri::AudioBuffer(32, 1.0f));
+        Syntri::MultiChannelBuffer outputs(2, Syntri::AudioBuffer(32, 9.0f));
+        processor.processAudio(inputs, outputs, 32);
+        passed &= check(processor.usesAudioBlocks(), "Uses the block callback");
+        passed &= check(outputs[0][31] == -0.5f && outputs[1][0] == 0.0f, "Legacy call reaches the chain");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
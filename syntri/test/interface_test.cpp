@@ -3,7 +3,9 @@
 // Copyright (c) 2025 Syntri Technologies
 
 #include "syntri/audio_interface.h"
+#include "syntri/stub_interface.h"
 #include <iostream>
+#include <algorithm>
 #include <thread>
 #include <chrono>
 
@@ -107,17 +109,23 @@ int main() {
         std::cout << "🔧 Test 5: Audio Streaming" << std::endl;
         TestAudioProcessor processor;
 
+        // Virtual time runs two seconds of buffers as fast as the processor allows
+        Syntri::StubInterfaceOptions stream_options;
+        stream_options.virtual_time = true;
+        auto stream_interface = Syntri::createStubInterface(stream_options);
+        stream_interface->initialize(Syntri::SAMPLE_RATE_96K, Syntri::BUFFER_SIZE_ULTRA_LOW);
+
         // Start streaming
-        bool stream_result = test_interface->startStreaming(&processor);
-        if (stream_result && test_interface->isStreaming()) {
+        bool stream_result = stream_interface->startStreaming(&processor);
+        if (stream_result && stream_interface->isStreaming()) {
             std::cout << "✅ Audio streaming started" << std::endl;
 
-            // Simulate some processing time
             std::cout << "  Simulating audio processing for 2 seconds..." << std::endl;
-            std::this_thread::sleep_for(std::chrono::seconds(2));
+            const int buffers = 2 * Syntri::SAMPLE_RATE_96K / Syntri::BUFFER_SIZE_ULTRA_LOW;
+            int stepped = stream_interface->stepBuffers(buffers);
 
             // Check if streaming is still active
-            if (test_interface->isStreaming()) {
+            if (stream_interface->isStreaming() && stepped == buffers) {
                 std::cout << "✅ Audio streaming still active" << std::endl;
             }
             else {
@@ -125,13 +133,30 @@ int main() {
             }
 
             // Stop streaming
-            test_interface->stopStreaming();
-            if (!test_interface->isStreaming()) {
+            stream_interface->stopStreaming();
+            if (!stream_interface->isStreaming()) {
                 std::cout << "✅ Audio streaming stopped successfully" << std::endl;
             }
             else {
                 std::cout << "❌ Failed to stop audio streaming" << std::endl;
             }
+
+            // Every stepped buffer is one callback
+            auto stream_metrics = stream_interface->getMetrics();
+            std::cout << "  Callbacks: " << processor.getCallbackCount() << std::endl;
+            std::cout << "  Avg processing: " << stream_metrics.processing_time_ms << " ms" << std::endl;
+            std::cout << "  Avg / max jitter: " << stream_metrics.jitter_ms << " / "
+                << stream_metrics.max_jitter_ms << " ms" << std::endl;
+            std::cout << "  CPU Usage: " << stream_metrics.cpu_usage_percent << "%" << std::endl;
+            if (processor.getCallbackCount() == buffers &&
+                stream_metrics.callback_count == processor.getCallbackCount() &&
+                stream_metrics.buffer_underruns == 0) {
+                std::cout << "✅ Audio callbacks processed" << std::endl;
+            }
+            else {
+                std::cout << "❌ No audio callbacks were processed" << std::endl;
+                return 1;
+            }
         }
         else {
             std::cout << "❌ Failed to start audio streaming" << std::endl;
@@ -0,0 +1,154 @@
+// Syntri Logger Test - Asynchronous Logging Verification
+// Checks level filtering, compile-time elision, multi-thread delivery and real-time safety
+// Copyright (c) 2025 Syntri Technologies
+
+// Compile VERBOSE out of this file to check elision
+#define SYNTRI_LOG_COMPILE_LEVEL 1
+
+#include "syntri/log.h"
+#include "syntri/rt_safety.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Only touched from the sink, which runs under the logger's drain lock
+static std::vector<Syntri::LogRecord> captured;
+
+static void captureSink(const Syntri::LogRecord& record) {
+    captured.push_back(record);
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - ASYNC LOGGER TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    Syntri::setLogSink(captureSink);
+
+    // Test 1: Levels
+    std::cout << "🔧 Test 1: Level filtering" << std::endl;
+    {
+        Syntri::setLogLevel(Syntri::LogLevel::INFO);
+        SYNTRI_LOG(Syntri::LogLevel::VERBOSE, "filtered %d", 1);
+        SYNTRI_LOG_INFO("info %d", 2);
+        SYNTRI_LOG_WARNING("warning %s", "three");
+        Syntri::flushLog();
+
+        passed &= check(captured.size() == 2, "Messages below the runtime level are dropped");
+        passed &= check(captured.size() == 2 && std::strcmp(captured[0].text, "info 2") == 0 &&
+            captured[1].level == Syntri::LogLevel::WARNING, "Formatted text and level delivered in order");
+
+        captured.clear();
+        Syntri::setLogLevel(Syntri::LogLevel::VERBOSE);
+        int evaluated = 0;
+        SYNTRI_LOG_VERBOSE("never %d", ++evaluated);
+        Syntri::flushLog();
+        passed &= check(captured.empty() && evaluated == 0, "Compiled-out calls do not evaluate their arguments");
+        Syntri::setLogLevel(Syntri::LogLevel::INFO);
+
+        std::string long_message(1000, 'x');
+        SYNTRI_LOG_INFO("%s", long_message.c_str());
+        Syntri::flushLog();
+        passed &= check(captured.size() == 1 && std::strlen(captured[0].text) == Syntri::LOG_MESSAGE_CAPACITY - 1,
+            "Long messages are truncated, not overflowed");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Many threads
+    std::cout << "🔧 Test 2: Concurrent producers" << std::endl;
+    {
+        captured.clear();
+        const long long dropped_before = Syntri::getDroppedLogMessages();
+        const int threads = 4;
+        const int messages = 2000;
+
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threads; ++t) {
+            producers.emplace_back([t]() {
+                for (int m = 0; m < messages; ++m) {
+                    SYNTRI_LOG_INFO("%d %d", t, m);
+                    if (m % 64 == 63) std::this_thread::sleep_for(std::chrono::milliseconds(1));    // Let the drain thread in
+                }
+            });
+        }
+        for (auto& producer : producers) producer.join();
+        Syntri::flushLog();
+
+        const long long dropped = Syntri::getDroppedLogMessages() - dropped_before;
+        std::vector<int> last(threads, -1);
+        bool ordered = true;
+        for (const auto& record : captured) {
+            int t = -1, m = -1;
+            if (std::sscanf(record.text, "%d %d", &t, &m) != 2 || t < 0 || t >= threads || m <= last[t]) {
+                ordered = false;
+                break;
+            }
+            last[t] = m;
+        }
+        std::cout << "  Delivered " << captured.size() << ", dropped " << dropped << std::endl;
+        passed &= check(static_cast<long long>(captured.size()) + dropped == threads * messages,
+            "Every message is delivered or counted as dropped");
+        passed &= check(ordered, "Per-thread order preserved");
+
+        captured.clear();
+        for (int t = 0; t < Syntri::LOG_MAX_THREADS + 8; ++t) {
+            std::thread([t]() { SYNTRI_LOG_INFO("short-lived %d", t); }).join();
+            Syntri::flushLog();
+        }
+        passed &= check(static_cast<int>(captured.size()) == Syntri::LOG_MAX_THREADS + 8,
+            "Rings of exited threads are reused");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Audio thread use
+    std::cout << "🔧 Test 3: Logging from a callback" << std::endl;
+    {
+        // A sink that stalls like a slow console
+        Syntri::setLogSink([](const Syntri::LogRecord& record) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            captureSink(record);
+        });
+        captured.clear();
+
+        double worst_us = 0.0;
+        long long violations = 0;
+        std::thread audio([&]() {
+            Syntri::registerLogThread();
+            Syntri::resetRealtimeViolationCount();
+            Syntri::RealtimeCallbackScope callback;
+            for (int i = 0; i < 64; ++i) {
+                auto start = std::chrono::steady_clock::now();
+                SYNTRI_LOG_INFO("callback %d, gain %.2f", i, 0.5);
+                worst_us = std::max(worst_us, std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - start).count());
+            }
+            violations = Syntri::getRealtimeViolationCount();
+        });
+        audio.join();
+        Syntri::flushLog();
+
+        std::cout << "  Worst call: " << worst_us << " us" << std::endl;
+        passed &= check(captured.size() == 64, "All callback messages delivered");
+        if (Syntri::realtimeSafetyChecksInstalled()) {
+            passed &= check(violations == 0, "No allocation, lock or syscall on the logging path");
+        }
+        passed &= check(worst_us < 20000.0, "Producer never waits for the sink");
+    }
+    std::cout << std::endl;
+
+    Syntri::setLogSink(nullptr);
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
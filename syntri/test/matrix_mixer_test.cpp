@@ -0,0 +1,196 @@
+// Syntri Matrix Mixer Test - Personal Mix Engine Verification
+// Checks routing, pan law, zipper-free smoothing, tiled rendering and
+// sample-accurate commands
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/matrix_mixer.h"
+#include "test_helpers.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+
+static bool near(float a, float b, float tolerance = 1.0e-5f) {
+    return std::fabs(a - b) <= tolerance;
+}
+
+// Fills every input channel with a constant so mix outputs are easy to predict
+static void fillInputs(Syntri::AudioBlockStorage& storage) {
+    Syntri::AudioBlock block = storage.getBlock();
+    for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+        for (int sample = 0; sample < block.getNumFrames(); ++sample) {
+            block.getChannel(ch)[sample] = static_cast<float>(ch + 1);
+        }
+    }
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - MATRIX MIXER TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    const int frames = Syntri::BUFFER_SIZE_ULTRA_LOW;
+
+    // Test 1: Routing and pan law
+    std::cout << "🔧 Test 1: Routing and pan law" << std::endl;
+    {
+        Syntri::MatrixMixer mixer(4, 2);
+        mixer.setupChanged(Syntri::SAMPLE_RATE_96K, frames);
+        mixer.setGain(0, 0, 1.0f);
+        mixer.setPan(0, 0, -1.0f);
+        mixer.setGain(1, 0, 0.5f);
+        mixer.setPan(1, 0, 1.0f);
+        mixer.setGain(2, 1, 1.0f);
+        mixer.setMixLevel(1, 2.0f);
+        mixer.snapToTargets();
+
+        Syntri::AudioBlockStorage inputs(4, frames);
+        Syntri::AudioBlockStorage outputs(6, frames);
+        fillInputs(inputs);
+        outputs.getBlock().getChannel(5)[0] = 99.0f;
+        mixer.processAudio(inputs.getBlock(), outputs.getBlock());
+
+        Syntri::AudioBlock out = outputs.getBlock();
+        passed &= check(near(out.getChannel(0)[7], 1.0f) && near(out.getChannel(1)[7], 1.0f),
+            "Hard-panned inputs land on their own side");
+        float center = 3.0f * 2.0f * std::sqrt(0.5f);
+        passed &= check(near(out.getChannel(2)[7], center) && near(out.getChannel(3)[7], center),
+            "Centre pan is -3 dB per side, mix level applied");
+        passed &= check(out.getChannel(5)[0] == 0.0f, "Unused output channels are cleared");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Smoothing
+    std::cout << "🔧 Test 2: Zipper-free gain changes" << std::endl;
+    {
+        Syntri::MatrixMixer mixer(1, 1);
+        mixer.setupChanged(Syntri::SAMPLE_RATE_96K, frames);
+        mixer.setPan(0, 0, -1.0f);
+        mixer.snapToTargets();
+
+        Syntri::AudioBlockStorage inputs(1, frames);
+        Syntri::AudioBlockStorage outputs(2, frames);
+        fillInputs(inputs);
+
+        mixer.setGain(0, 0, 1.0f);   // Full-scale step
+        float previous = 0.0f;
+        float largest_step = 0.0f;
+        for (int block = 0; block < 600; ++block) {
+            mixer.processAudio(inputs.getBlock(), outputs.getBlock());
+            const float* left = outputs.getBlock().getChannel(0);
+            for (int sample = 0; sample < frames; ++sample) {
+                largest_step = std::max(largest_step, std::fabs(left[sample] - previous));
+                previous = left[sample];
+            }
+        }
+        std::cout << "  Largest per-sample step: " << largest_step << std::endl;
+        passed &= check(largest_step < 0.005f, "No audible step for an instant 0 -> 1 change");
+        passed &= check(near(previous, 1.0f, 1.0e-4f), "Gain settles on its target");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Tiling
+    std::cout << "🔧 Test 3: Tiled rendering of large buffers" << std::endl;
+    {
+        const int large = 256;
+        Syntri::MatrixMixer mixer(8, 4);
+        mixer.setupChanged(Syntri::SAMPLE_RATE_48K, large);
+        mixer.setSmoothingTime(1.0);
+        for (int mix = 0; mix < 4; ++mix) mixer.setGain(mix, mix, 1.0f);
+
+        Syntri::AudioBlockStorage inputs(8, large);
+        Syntri::AudioBlockStorage outputs(8, large);
+        fillInputs(inputs);
+        mixer.processAudio(inputs.getBlock(), outputs.getBlock());
+
+        bool smooth = true;
+        for (int ch = 0; ch < 8; ++ch) {
+            const float* channel = outputs.getBlock().getChannel(ch);
+            for (int sample = 1; sample < large; ++sample) {
+                smooth &= std::fabs(channel[sample] - channel[sample - 1]) < 0.05f;
+            }
+        }
+        passed &= check(smooth, "Ramps continue seamlessly across tile boundaries");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Sample-accurate commands
+    std::cout << "🔧 Test 4: Queued commands land on their frame" << std::endl;
+    {
+        Syntri::MatrixMixer mixer(2, 1);
+        mixer.setupChanged(Syntri::SAMPLE_RATE_96K, frames);
+        mixer.setSmoothingTime(0.0);
+        mixer.setGain(0, 0, 1.0f);
+        mixer.setPan(0, 0, -1.0f);
+        mixer.snapToTargets();
+
+        Syntri::AudioBlockStorage inputs(2, frames);
+        Syntri::AudioBlockStorage outputs(2, frames);
+        fillInputs(inputs);
+
+        Syntri::MixerCommand route;
+        route.type = Syntri::MixerCommandType::SET_GAIN;
+        route.input = 1;
+        route.value = 1.0f;
+        route.sample_offset = 20;
+        Syntri::MixerCommand mute;
+        mute.type = Syntri::MixerCommandType::SET_MUTE;
+        mute.input = 0;
+        mute.value = 1.0f;
+        mute.sample_offset = 10;
+        passed &= check(mixer.postCommand(route) && mixer.postCommand(mute), "Commands posted");
+
+        mixer.processAudio(inputs.getBlock(), outputs.getBlock());
+        const float* left = outputs.getBlock().getChannel(0);
+        bool before = true;
+        for (int sample = 0; sample <= 10; ++sample) before &= left[sample] == 1.0f;
+        passed &= check(before && left[11] < 1.0f, "Mute starts on frame 10, not at the block edge");
+        passed &= check(outputs.getBlock().getChannel(1)[20] == 0.0f && outputs.getBlock().getChannel(1)[21] > 0.0f,
+            "Out-of-order offsets are applied in frame order");
+
+        mixer.processAudio(inputs.getBlock(), outputs.getBlock());
+        passed &= check(near(left[0], std::sqrt(0.5f) * 2.0f) && mixer.isMuted(0, 0) && mixer.getGain(1, 0) == 1.0f,
+            "Next block holds the new state");
+    }
+    std::cout << std::endl;
+
+    // Test 5: Throughput (informational)
+    std::cout << "🔧 Test 5: 64 inputs x 24 personal mixes" << std::endl;
+    {
+        Syntri::MatrixMixer mixer(64, 24);
+        mixer.setupChanged(Syntri::SAMPLE_RATE_96K, frames);
+        for (int mix = 0; mix < 24; ++mix) {
+            for (int input = 0; input < 64; ++input) {
+                mixer.setGain(input, mix, 0.1f);
+                mixer.setPan(input, mix, (input % 9) / 4.0f - 1.0f);
+            }
+        }
+        mixer.snapToTargets();
+
+        Syntri::AudioBlockStorage inputs(64, frames);
+        Syntri::AudioBlockStorage outputs(48, frames);
+        fillInputs(inputs);
+
+        const int iterations = 2000;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            mixer.processAudio(inputs.getBlock(), outputs.getBlock());
+        }
+        double per_block_us = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count() / iterations;
+        double period_us = 1.0e6 * frames / Syntri::SAMPLE_RATE_96K;
+        std::cout << "  " << per_block_us << " us per block (" << (per_block_us / period_us) * 100.0
+            << "% of a " << period_us << " us period)" << std::endl;
+        passed &= check(near(outputs.getBlock().getChannel(0)[0] + outputs.getBlock().getChannel(1)[0],
+            outputs.getBlock().getChannel(46)[0] + outputs.getBlock().getChannel(47)[0], 1.0e-3f),
+            "All mixes rendered");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+// Syntri Offline Interface Test - File Rendering Verification
+// Checks WAV/raw round trips, block padding, golden comparison and throughput reporting
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/offline_interface.h"
+#include "syntri/matrix_mixer.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Minimal RIFF/WAVE with a 16-byte fmt chunk and the given data bytes
+static void writeWavBytes(const std::string& path, int format, int channels, int bits,
+    const std::vector<unsigned char>& data) {
+    std::vector<unsigned char> bytes;
+    auto u32 = [&bytes](unsigned value) {
+        for (int shift = 0; shift < 32; shift += 8) bytes.push_back(static_cast<unsigned char>(value >> shift));
+    };
+    auto u16 = [&bytes](unsigned value) {
+        for (int shift = 0; shift < 16; shift += 8) bytes.push_back(static_cast<unsigned char>(value >> shift));
+    };
+    bytes.insert(bytes.end(), { 'R', 'I', 'F', 'F' });
+    u32(static_cast<unsigned>(4 + 24 + 8 + data.size()));
+    bytes.insert(bytes.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+    u32(16);
+    u16(static_cast<unsigned>(format));
+    u16(static_cast<unsigned>(channels));
+    u32(48000);
+    u32(static_cast<unsigned>(48000 * channels * std::max(bits / 8, 1)));
+    u16(static_cast<unsigned>(channels * std::max(bits / 8, 1)));
+    u16(static_cast<unsigned>(bits));
+    bytes.insert(bytes.end(), { 'd', 'a', 't', 'a' });
+    u32(static_cast<unsigned>(data.size()));
+    bytes.insert(bytes.end(), data.begin(), data.end());
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()),
+        static_cast<std::streamsize>(bytes.size()));
+}
+
+// Deterministic non-trivial content: channel-dependent ramps
+static void fillSignal(Syntri::AudioBlockStorage& storage) {
+    Syntri::AudioBlock block = storage.getBlock();
+    for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+        for (int sample = 0; sample < block.getNumFrames(); ++sample) {
+            block.getChannel(ch)[sample] = static_cast<float>(((sample * (ch + 3)) % 200) - 100) / 128.0f;
+        }
+    }
+}
+
+static bool sameBlocks(const Syntri::ConstAudioBlock& a, const Syntri::ConstAudioBlock& b) {
+    if (a.getNumChannels() != b.getNumChannels() || a.getNumFrames() != b.getNumFrames()) return false;
+    for (int ch = 0; ch < a.getNumChannels(); ++ch) {
+        for (int sample = 0; sample < a.getNumFrames(); ++sample) {
+            if (a.getChannel(ch)[sample] != b.getChannel(ch)[sample]) return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - OFFLINE INTERFACE TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    const std::string input_wav = "syntri_offline_input.wav";
+    const std::string output_wav = "syntri_offline_output.wav";
+    const std::string output_raw = "syntri_offline_output.raw";
+
+    // 1000 frames is not a multiple of the block size - exercises padding
+    const int channels = 4;
+    const int frames = 1000;
+    Syntri::AudioBlockStorage source(channels, frames);
+    fillSignal(source);
+
+    // Test 1: WAV round trip
+    std::cout << "🔧 Test 1: WAV file I/O" << std::endl;
+    {
+        std::string error;
+        const Syntri::AudioBlockStorage& constant_source = source;
+        bool written = Syntri::writeAudioFile(input_wav, Syntri::AudioFileFormat::WAV,
+            constant_source.getBlock(), Syntri::SAMPLE_RATE_48K, error);
+
+        Syntri::AudioFileInfo info;
+        std::vector<Syntri::AudioSample> samples;
+        bool read = Syntri::readAudioFile(input_wav, Syntri::AudioFileFormat::WAV, 0, info, samples, error);
+        passed &= check(written && read && info.num_channels == channels && info.num_frames == frames &&
+            info.sample_rate == Syntri::SAMPLE_RATE_48K, "Float WAV header round-trips");
+        passed &= check(read && samples[3 * channels + 2] == source.getBlock().getChannel(2)[3],
+            "Samples are interleaved and bit-exact");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Passthrough render against the input as golden
+    std::cout << "🔧 Test 2: Passthrough render" << std::endl;
+    {
+        Syntri::OfflineRenderOptions options;
+        options.input_path = input_wav;
+        options.output_path = output_wav;
+        auto renderer = Syntri::createOfflineInterface(options);
+        auto processor = Syntri::createTestProcessor(false);
+
+        bool ok = renderer->initialize(Syntri::SAMPLE_RATE_96K, Syntri::BUFFER_SIZE_LOW);
+        ok = ok && renderer->render(processor.get());
+        passed &= check(ok, "Rendered and wrote output file");
+
+        Syntri::OfflineRenderStats stats = renderer->getRenderStats();
+        passed &= check(stats.frames_rendered == frames && stats.blocks_rendered == 16,
+            "Short final block is padded, output trimmed to input length");
+        passed &= check(stats.realtime_multiple > 1.0, "Renders faster than real time");
+        std::cout << "  " << stats.realtime_multiple << "x real time" << std::endl;
+
+        std::string error;
+        Syntri::AudioFileInfo info;
+        std::vector<Syntri::AudioSample> samples;
+        bool read = Syntri::readAudioFile(output_wav, Syntri::AudioFileFormat::WAV, 0, info, samples, error);
+        bool identical = read && info.sample_rate == Syntri::SAMPLE_RATE_48K && info.num_frames == frames;
+        for (int frame = 0; identical && frame < frames; ++frame) {
+            for (int ch = 0; ch < channels; ++ch) {
+                identical &= samples[frame * channels + ch] == source.getBlock().getChannel(ch)[frame];
+            }
+        }
+        passed &= check(identical, "Output file matches the golden input at the file's own sample rate");
+        passed &= check(renderer->getMetrics().callback_count == 16, "Per-block metrics recorded");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Background render of a mixer to raw output
+    std::cout << "🔧 Test 3: Streaming render to raw output" << std::endl;
+    {
+        Syntri::OfflineRenderOptions options;
+        options.input_path = input_wav;
+        options.output_path = output_raw;
+        options.output_format = Syntri::AudioFileFormat::RAW_FLOAT32;
+        options.num_output_channels = 2;
+        auto renderer = Syntri::createOfflineInterface(options);
+
+        Syntri::MatrixMixer mixer(channels, 1);
+        mixer.setGain(1, 0, 1.0f);
+        mixer.setPan(1, 0, -1.0f);
+        mixer.snapToTargets();
+
+        bool ok = renderer->initialize(Syntri::SAMPLE_RATE_48K, Syntri::BUFFER_SIZE_ULTRA_LOW);
+        ok = ok && renderer->startStreaming(&mixer);
+        renderer->waitForCompletion();
+        passed &= check(ok && !renderer->isStreaming() && renderer->outputWritten(), "Background render completed");
+        passed &= check(sameBlocks(renderer->getOutput().getChannelRange(0, 1),
+            Syntri::ConstAudioBlock(source.getBlock()).getChannelRange(1, 1)), "In-memory output is the routed input");
+
+        std::string error;
+        Syntri::AudioFileInfo info;
+        std::vector<Syntri::AudioSample> samples;
+        bool read = Syntri::readAudioFile(output_raw, Syntri::AudioFileFormat::RAW_FLOAT32, 2, info, samples, error);
+        passed &= check(read && info.num_frames == frames && samples[2 * 10] == source.getBlock().getChannel(1)[10],
+            "Raw output holds interleaved float32");
+
+        // Finishing on its own must leave the renderer reusable without waitForCompletion()
+        ok = renderer->startStreaming(&mixer);
+        while (ok && renderer->isStreaming()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        passed &= check(ok && renderer->startStreaming(&mixer), "Restarts after a render that ran to the end");
+        renderer->waitForCompletion();
+    }
+    std::cout << std::endl;
+
+    // Test 4: Error handling
+    std::cout << "🔧 Test 4: Bad input" << std::endl;
+    {
+        Syntri::OfflineRenderOptions options;
+        options.input_path = "syntri_missing_input.wav";
+        auto renderer = Syntri::createOfflineInterface(options);
+        passed &= check(!renderer->initialize(), "Missing input file is rejected");
+
+        // 4-bit IMA ADPCM: a valid file, but not one we decode
+        const std::string adpcm_wav = "syntri_offline_adpcm.wav";
+        writeWavBytes(adpcm_wav, 0x11, 1, 4, std::vector<unsigned char>(256, 0x77));
+        Syntri::AudioFileInfo info;
+        std::vector<Syntri::AudioSample> samples;
+        std::string error;
+        bool read = Syntri::readAudioFile(adpcm_wav, Syntri::AudioFileFormat::WAV, 0, info, samples, error);
+        passed &= check(!read && error.find("Unsupported") != std::string::npos, "Compressed WAV is refused with an error");
+
+        // 8-bit PCM is unsigned
+        const std::string pcm8_wav = "syntri_offline_pcm8.wav";
+        writeWavBytes(pcm8_wav, 0x01, 2, 8, { 128, 192, 0, 255 });
+        read = Syntri::readAudioFile(pcm8_wav, Syntri::AudioFileFormat::WAV, 0, info, samples, error);
+        passed &= check(read && info.num_frames == 2 && samples[0] == 0.0f && samples[1] == 0.5f && samples[2] == -1.0f,
+            "8-bit PCM decodes");
+        std::remove(adpcm_wav.c_str());
+        std::remove(pcm8_wav.c_str());
+    }
+    std::cout << std::endl;
+
+    std::remove(input_wav.c_str());
+    std::remove(output_wav.c_str());
+    std::remove(output_raw.c_str());
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
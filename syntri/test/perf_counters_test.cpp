@@ -0,0 +1,173 @@
+// Syntri Hardware Counter Test - perf_event_open Profiling Verification
+// Checks counter reads, per-callback aggregation and graceful fallback without a PMU
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/perf_counters.h"
+#include "syntri/offline_interface.h"
+#include "syntri/rt_safety.h"
+#include "syntri/stub_interface.h"
+#include "test_helpers.h"
+#include <iostream>
+#include <string>
+
+// Work the optimizer cannot drop
+static volatile float sink = 0.0f;
+static void spin(int iterations) {
+    float value = 0.0f;
+    for (int i = 0; i < iterations; ++i) {
+        value += static_cast<float>(i & 7) * 0.5f;
+        sink = value;
+    }
+}
+
+class CopyProcessor : public StubProcessor {
+public:
+    void processAudio(const Syntri::ConstAudioBlock& inputs, const Syntri::AudioBlock& outputs) override {
+        Syntri::copyBlock(inputs, outputs);
+        spin(2000);
+    }
+};
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - HARDWARE COUNTER TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    bool available = false;
+
+    // Test 1: Direct reads
+    std::cout << "🔧 Test 1: Counter group" << std::endl;
+    {
+        Syntri::PerfCounterGroup counters;
+        std::string notes;
+        available = counters.open(&notes);
+        std::cout << "  Counters: " << (available ? "available" : "unavailable") << std::endl;
+        if (!notes.empty()) {
+            std::cout << "  Notes: " << notes << std::endl;
+        }
+        passed &= check(available || !notes.empty(), "Missing counters are explained");
+
+        if (counters.isAvailable(Syntri::PerfCounter::INSTRUCTIONS)) {
+            Syntri::PerfCounterValues start, middle, end;
+            counters.read(start);
+            spin(1000);
+            counters.read(middle);
+            spin(100000);
+            counters.read(end);
+
+            auto small = Syntri::PerfCounterValues::difference(middle, start);
+            auto large = Syntri::PerfCounterValues::difference(end, middle);
+            passed &= check(small[Syntri::PerfCounter::INSTRUCTIONS] > 1000, "Instructions counted");
+            passed &= check(large[Syntri::PerfCounter::INSTRUCTIONS] > 10 * small[Syntri::PerfCounter::INSTRUCTIONS],
+                "Counts scale with work");
+        }
+
+        Syntri::resetRealtimeViolationCount();
+        {
+            Syntri::RealtimeCallbackScope callback;
+            Syntri::PerfCounterValues values;
+            counters.read(values);
+        }
+        if (Syntri::realtimeSafetyChecksInstalled()) {
+            passed &= check(Syntri::getRealtimeViolationCount() == 0, "Reading is allowed in the callback");
+        }
+
+        counters.close();
+        passed &= check(!counters.isOpen() && counters.availableMask() == 0, "Close releases every counter");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Aggregation through an interface
+    std::cout << "🔧 Test 2: Per-callback totals in the metrics snapshot" << std::endl;
+    {
+        Syntri::OfflineRenderOptions options;
+        options.num_input_channels = 2;
+        options.length_frames = 64 * 50;
+
+        CopyProcessor processor;
+        Syntri::OfflineAudioInterface plain(options);
+        plain.initialize(48000, 64);
+        plain.render(&processor);
+        auto disabled = plain.getMetricsSnapshot().hardware_counters;
+        passed &= check(disabled.available_mask == 0 && disabled.callbacks == 0, "Off unless enabled");
+
+        Syntri::OfflineAudioInterface counted(options);
+        counted.initialize(48000, 64);
+        counted.setHardwareCountersEnabled(true);
+        passed &= check(counted.render(&processor), "Render with counters enabled");
+
+        auto summary = counted.getMetricsSnapshot().hardware_counters;
+        if (available) {
+            passed &= check(summary.callbacks == 50, "One sample per callback");
+            if (summary.isAvailable(Syntri::PerfCounter::INSTRUCTIONS)) {
+                passed &= check(summary.perCallback(Syntri::PerfCounter::INSTRUCTIONS) > 2000.0,
+                    "Instructions attributed to processAudio");
+            }
+            if (summary.isAvailable(Syntri::PerfCounter::CYCLES) && summary.isAvailable(Syntri::PerfCounter::INSTRUCTIONS)) {
+                std::cout << "  IPC: " << summary.instructionsPerCycle() << std::endl;
+            }
+        }
+        else {
+            passed &= check(summary.available_mask == 0 && summary.callbacks == 0, "Render proceeds without counters");
+        }
+    }
+    std::cout << std::endl;
+
+    // Test 3: Totals follow the processor
+    std::cout << "🔧 Test 3: Totals restart for a new processor" << std::endl;
+    {
+        Syntri::RealtimeMetrics metrics;
+        metrics.setHardwareCounterMask(0x3u);
+        Syntri::PerfCounterValues counts;
+        counts.values = { 100, 200, 1, 2, 3 };
+        metrics.recordHardwareCounters(counts);
+        metrics.recordHardwareCounters(counts);
+        metrics.resetHardwareCounters();
+        metrics.recordHardwareCounters(counts);
+        auto summary = metrics.snapshot().hardware_counters;
+        passed &= check(summary.callbacks == 1 && summary.totals[Syntri::PerfCounter::CYCLES] == 100,
+            "Reset drops the previous processor's counts");
+        passed &= check(summary.available_mask == 0x3u, "Availability survives the reset");
+
+        if (available) {
+            Syntri::StubInterfaceOptions stub_options;
+            stub_options.virtual_time = true;
+            Syntri::StubAudioInterface stub(stub_options);
+            CopyProcessor first;
+            CopyProcessor second;
+            stub.initialize(48000, 64);
+            stub.setHardwareCountersEnabled(true);
+            stub.startStreaming(&first);
+            stub.stepBuffers(20);
+            stub.swapProcessor(&second, 128);     // Two crossfade periods, not counted
+            stub.stepBuffers(10);
+            std::uint64_t callbacks = stub.getMetricsSnapshot().hardware_counters.callbacks;
+            stub.stopStreaming();
+            std::cout << "  Counted callbacks after the swap: " << callbacks << std::endl;
+            passed &= check(callbacks == 10, "Stub counts only the new processor");
+        }
+    }
+    std::cout << std::endl;
+
+    // Test 4: Derived ratios
+    std::cout << "🔧 Test 4: Summary ratios" << std::endl;
+    {
+        Syntri::HardwareCounterSummary summary;
+        summary.callbacks = 4;
+        summary.totals.values = { 2000, 4000, 8, 2, 20 };
+        passed &= check(summary.instructionsPerCycle() == 2.0, "Instructions per cycle");
+        passed &= check(summary.perCallback(Syntri::PerfCounter::CYCLES) == 500.0, "Mean per callback");
+        passed &= check(summary.missesPerKiloInstruction(Syntri::PerfCounter::BRANCH_MISSES) == 5.0,
+            "Misses per thousand instructions");
+        passed &= check(Syntri::HardwareCounterSummary().instructionsPerCycle() == 0.0, "Empty summary is zero");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+// Syntri Period Scheduler Test - Absolute Deadline Verification
+// Checks drift-free boundaries, sleep and spin wake-ups, margin adaptation and catch-up
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/period_scheduler.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static std::int64_t median(std::vector<std::int64_t> values) {
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0 : values[values.size() / 2];
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - PERIOD SCHEDULER TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Boundaries
+    std::cout << "🔧 Test 1: Drift-free boundaries" << std::endl;
+    {
+        Syntri::PeriodScheduler scheduler;
+        scheduler.start(96000, 32);
+        const std::uint64_t origin = scheduler.deadlineNanoseconds(0);
+        passed &= check(scheduler.getPeriodNanoseconds() == 333333, "32 frames at 96 kHz is 333333 ns");
+        passed &= check(scheduler.deadlineNanoseconds(3000) - origin == 1000000000ULL,
+            "3000 periods land exactly on one second");
+        passed &= check(scheduler.deadlineNanoseconds(3000 * 3600) - origin == 3600ULL * 1000000000ULL,
+            "No rounding drift after an hour");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Sleep only
+    std::cout << "🔧 Test 2: Sleep-only cadence" << std::endl;
+    {
+        Syntri::PeriodSchedulerOptions options;
+        options.spin = false;
+        Syntri::PeriodScheduler scheduler(options);
+        scheduler.start(48000, 480);
+
+        bool consecutive = true;
+        bool on_time = true;
+        long long previous = 0;
+        for (int i = 0; i < 30; ++i) {
+            Syntri::PeriodWake wake = scheduler.waitForNextPeriod();
+            consecutive &= wake.period_index == previous + 1 + wake.skipped_periods;
+            on_time &= wake.lateness_ns >= 0;
+            previous = wake.period_index;
+        }
+        const std::int64_t total_error = static_cast<std::int64_t>(Syntri::PeriodScheduler::nowNanoseconds()) -
+            static_cast<std::int64_t>(scheduler.deadlineNanoseconds(previous));
+        // Boundaries are absolute (Test 1), so this is one wake-up's lateness
+        // and depends on the host - reported, not asserted
+        std::cout << "  End of 30 periods: " << total_error / 1000 << " us after the boundary" << std::endl;
+        passed &= check(consecutive, "Periods advance one at a time");
+        passed &= check(on_time, "Never wakes before the boundary");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Sleep then spin
+    std::cout << "🔧 Test 3: Hybrid sleep/spin wake-up" << std::endl;
+    {
+        Syntri::PeriodSchedulerOptions options;
+        options.spin = true;
+        options.initial_spin_margin_ns = 200000;
+        Syntri::PeriodScheduler scheduler(options);
+        scheduler.start(48000, 64);
+
+        std::vector<std::int64_t> lateness;
+        bool margin_bounded = true;
+        for (int i = 0; i < 300; ++i) {
+            Syntri::PeriodWake wake = scheduler.waitForNextPeriod();
+            lateness.push_back(wake.lateness_ns);
+            margin_bounded &= scheduler.getSpinMarginNanoseconds() >= options.min_spin_margin_ns &&
+                scheduler.getSpinMarginNanoseconds() <= scheduler.getPeriodNanoseconds() / 2;
+        }
+        // Wake-up precision depends on the host, so it is reported, not asserted
+        std::cout << "  Median lateness: " << median(lateness) / 1000.0 << " us, spin margin now "
+            << scheduler.getSpinMarginNanoseconds() / 1000.0 << " us" << std::endl;
+        passed &= check(*std::min_element(lateness.begin(), lateness.end()) >= 0, "Spin never releases early");
+        passed &= check(margin_bounded, "Margin stays within [minimum, half a period]");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Falling behind
+    std::cout << "🔧 Test 4: Catch-up after a stall" << std::endl;
+    {
+        Syntri::PeriodSchedulerOptions options;
+        options.spin = false;
+        Syntri::PeriodScheduler scheduler(options);
+        scheduler.start(48000, 480);
+        scheduler.waitForNextPeriod();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(55));
+        Syntri::PeriodWake wake = scheduler.waitForNextPeriod();
+        std::cout << "  Skipped " << wake.skipped_periods << " periods, resumed at " << wake.period_index << std::endl;
+        passed &= check(wake.skipped_periods >= 4, "Missed boundaries are skipped");
+        passed &= check(wake.lateness_ns < scheduler.getPeriodNanoseconds(), "Resumes on the next boundary, not late");
+
+        Syntri::PeriodWake next = scheduler.waitForNextPeriod();
+        passed &= check(next.period_index == wake.period_index + 1 && next.skipped_periods == 0, "Cadence continues");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
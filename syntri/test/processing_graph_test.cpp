@@ -0,0 +1,172 @@
+// Syntri Processing Graph Test - DAG Plan Verification
+// Checks routing and summing, level order, buffer reuse, cycle rejection and parallel levels
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/processing_graph.h"
+#include "test_helpers.h"
+#include <cmath>
+#include <iostream>
+
+// Render one block of constant input through `graph`
+static void render(Syntri::ProcessingGraph& graph, const std::vector<float>& input_levels,
+    Syntri::AudioBlockStorage& output, int frames) {
+    Syntri::AudioBlockStorage input;
+    input.allocate(static_cast<int>(input_levels.size()), frames);
+    for (size_t ch = 0; ch < input_levels.size(); ++ch) {
+        for (int i = 0; i < frames; ++i) input.getBlock().getChannel(static_cast<int>(ch))[i] = input_levels[ch];
+    }
+    const Syntri::AudioBlockStorage& const_input = input;
+    graph.processAudio(const_input.getBlock(), output.getBlock());
+}
+
+static bool near(float value, float expected) {
+    return std::fabs(value - expected) < 1.0e-5f;
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - PROCESSING GRAPH TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Two strips summed into a group
+    std::cout << "🔧 Test 1: Routing and summing" << std::endl;
+    {
+        GainProcessor strip_a(2.0f);
+        GainProcessor strip_b(3.0f);
+        GainProcessor group(0.5f);
+        Syntri::ProcessingGraph graph(2, 3);
+        int a = graph.addNode(&strip_a, 1, 1);
+        int b = graph.addNode(&strip_b, 1, 1);
+        int g = graph.addNode(&group, 1, 1);
+        bool connected = graph.connect(Syntri::GRAPH_INPUT_NODE, 0, a, 0) &&
+            graph.connect(Syntri::GRAPH_INPUT_NODE, 1, b, 0) &&
+            graph.connect(a, 0, g, 0) && graph.connect(b, 0, g, 0) &&
+            graph.connect(g, 0, Syntri::GRAPH_OUTPUT_NODE, 0) &&
+            graph.connect(Syntri::GRAPH_INPUT_NODE, 0, Syntri::GRAPH_OUTPUT_NODE, 1);
+        passed &= check(connected && graph.compile(64), "Graph compiles");
+        passed &= check(!graph.connect(g, 1, a, 0) && !graph.connect(Syntri::GRAPH_OUTPUT_NODE, 0, a, 0),
+            "Out-of-range edges are refused");
+        passed &= check(graph.isCompiled() && graph.getNumLevels() == 2 && graph.getNodeLevel(a) == 0 &&
+            graph.getNodeLevel(b) == 0 && graph.getNodeLevel(g) == 1, "Strips share a level, the group follows");
+
+        Syntri::AudioBlockStorage output;
+        output.allocate(4, 64);
+        render(graph, { 1.0f, 0.25f }, output, 64);
+        const Syntri::AudioBlock out = output.getBlock();
+        passed &= check(near(out.getChannel(0)[63], 0.5f * (2.0f + 0.75f)), "Group sums both strips");
+        passed &= check(near(out.getChannel(1)[0], 1.0f), "Input routes straight to an output");
+        passed &= check(out.getChannel(2)[0] == 0.0f && out.getChannel(3)[0] == 0.0f, "Unrouted outputs are silent");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Buffer reuse
+    std::cout << "🔧 Test 2: Buffer lifetimes" << std::endl;
+    {
+        std::vector<GainProcessor> stages(10, GainProcessor(1.1f));
+        Syntri::ProcessingGraph graph(1, 1);
+        int previous = Syntri::GRAPH_INPUT_NODE;
+        for (auto& stage : stages) {
+            int node = graph.addNode(&stage, 1, 1);
+            graph.connect(previous, 0, node, 0);
+            previous = node;
+        }
+        graph.connect(previous, 0, Syntri::GRAPH_OUTPUT_NODE, 0);
+        graph.compile(32);
+
+        Syntri::AudioBlockStorage output;
+        output.allocate(1, 32);
+        render(graph, { 1.0f }, output, 32);
+        std::cout << "  " << graph.getIntermediateChannelCount() << " intermediate channels in "
+            << graph.getPoolChannelCount() << " pool channels" << std::endl;
+        passed &= check(graph.getPoolChannelCount() == 2 && graph.getIntermediateChannelCount() == 10,
+            "A 10-stage chain ping-pongs between two buffers");
+        passed &= check(near(output.getBlock().getChannel(0)[31], std::pow(1.1f, 10.0f)), "Chain result is exact");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Cycles
+    std::cout << "🔧 Test 3: Cycle rejection" << std::endl;
+    {
+        GainProcessor first(1.0f);
+        GainProcessor second(1.0f);
+        Syntri::ProcessingGraph graph(1, 1);
+        int a = graph.addNode(&first, 1, 1);
+        int b = graph.addNode(&second, 1, 1);
+        graph.connect(Syntri::GRAPH_INPUT_NODE, 0, a, 0);
+        graph.connect(a, 0, b, 0);
+        graph.connect(b, 0, a, 0);
+        graph.connect(b, 0, Syntri::GRAPH_OUTPUT_NODE, 0);
+
+        passed &= check(!graph.compile(32) && !graph.isCompiled(), "Feedback loop does not compile");
+        Syntri::AudioBlockStorage output;
+        output.allocate(1, 32);
+        render(graph, { 1.0f }, output, 32);
+        passed &= check(output.getBlock().getChannel(0)[0] == 0.0f, "Uncompiled graph outputs silence");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Parallel levels
+    std::cout << "🔧 Test 4: Parallel branches" << std::endl;
+    {
+        std::vector<GainProcessor> branches;
+        for (int i = 0; i < 8; ++i) branches.emplace_back(static_cast<float>(i + 1));
+        LegacyGainProcessor limiter(0.5f);
+        Syntri::ProcessingGraph graph(1, 1);
+        int bus = graph.addNode(&limiter, 1, 1);
+        for (auto& branch : branches) {
+            int node = graph.addNode(&branch, 1, 1);
+            graph.connect(Syntri::GRAPH_INPUT_NODE, 0, node, 0);
+            graph.connect(node, 0, bus, 0);
+        }
+        graph.connect(bus, 0, Syntri::GRAPH_OUTPUT_NODE, 0);
+        graph.compile(128);
+
+        Syntri::AudioBlockStorage serial_output;
+        serial_output.allocate(1, 128);
+        render(graph, { 1.0f }, serial_output, 128);
+
+        Syntri::WorkerPoolOptions pool_options;
+        pool_options.num_workers = 2;
+        pool_options.use_isolated_cpus = false;
+        Syntri::RealtimeWorkerPool pool(pool_options);
+        graph.setWorkerPool(&pool);
+        Syntri::AudioBlockStorage parallel_output;
+        parallel_output.allocate(1, 128);
+        bool stable = true;
+        for (int block = 0; block < 50; ++block) {
+            render(graph, { 1.0f }, parallel_output, 128);
+            stable &= parallel_output.getBlock().getChannel(0)[127] == serial_output.getBlock().getChannel(0)[127];
+        }
+        passed &= check(near(serial_output.getBlock().getChannel(0)[0], 0.5f * 36.0f), "Eight branches sum into a legacy bus node");
+        passed &= check(stable, "Worker pool renders the same result");
+    }
+    std::cout << std::endl;
+
+    // Test 5: Setup changes
+    std::cout << "🔧 Test 5: Setup forwarding" << std::endl;
+    {
+        GainProcessor stage(1.0f);
+        Syntri::ProcessingGraph graph(1, 1);
+        int node = graph.addNode(&stage, 1, 1);
+        graph.connect(Syntri::GRAPH_INPUT_NODE, 0, node, 0);
+        graph.connect(node, 0, Syntri::GRAPH_OUTPUT_NODE, 0);
+        graph.compile(32);
+        graph.setupChanged(48000, 256);
+
+        Syntri::AudioBlockStorage output;
+        output.allocate(1, 256);
+        render(graph, { 0.75f }, output, 256);
+        passed &= check(stage.buffer_size == 256, "Nodes see setupChanged");
+        passed &= check(near(output.getBlock().getChannel(0)[255], 0.75f), "Larger blocks recompile the plan");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
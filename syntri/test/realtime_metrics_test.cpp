@@ -0,0 +1,103 @@
+// Syntri Real-time Metrics Test - Histogram and Snapshot Verification
+// Checks bucket accuracy, tail percentiles and tear-free snapshots
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/realtime_metrics.h"
+#include "syntri/audio_interface.h"
+#include "test_helpers.h"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - REAL-TIME METRICS TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Bucket accuracy
+    std::cout << "🔧 Test 1: Log-scale buckets" << std::endl;
+    bool bounded = true;
+    bool monotonic = true;
+    for (std::uint64_t value = 1; value < (1ULL << 36); value = value * 3 / 2 + 1) {
+        int index = Syntri::histogramBucketIndex(value);
+        std::uint64_t upper = Syntri::histogramBucketUpperBound(index);
+        bounded &= upper >= value && (upper - value) <= value / 8 + 1;
+        if (index > 0) {
+            monotonic &= Syntri::histogramBucketUpperBound(index - 1) < value;
+        }
+    }
+    passed &= check(bounded, "Bucket upper bounds within 12.5% of value");
+    passed &= check(monotonic, "Each value lands in its first covering bucket");
+    passed &= check(Syntri::histogramBucketIndex(~0ULL) == Syntri::HISTOGRAM_BUCKET_COUNT - 1,
+        "Out-of-range values saturate in the last bucket");
+    std::cout << std::endl;
+
+    // Test 2: Tail percentiles
+    std::cout << "🔧 Test 2: Tail percentiles" << std::endl;
+    Syntri::RealtimeMetrics metrics;
+    metrics.setPeriod(Syntri::SAMPLE_RATE_96K, Syntri::BUFFER_SIZE_ULTRA_LOW);
+    for (int i = 0; i < 990; ++i) metrics.recordCallback(100000, 1000);   // 0.1 ms
+    for (int i = 0; i < 9; ++i) metrics.recordCallback(1000000, 1000);    // 1 ms
+    metrics.recordCallback(2000000, 50000);                               // 2 ms spike
+    metrics.recordXrun();
+
+    Syntri::MetricsSnapshot snapshot = metrics.snapshot();
+    Syntri::PercentileSummary duration = snapshot.callbackDurationMs();
+    std::cout << "  p50 " << duration.p50 << " ms, p99 " << duration.p99 << " ms, p99.9 "
+        << duration.p999 << " ms, max " << duration.max << " ms" << std::endl;
+    passed &= check(snapshot.callback_count == 1000 && snapshot.xrun_count == 1, "Counters");
+    passed &= check(duration.p50 >= 0.1 && duration.p50 < 0.113, "p50 reflects the typical callback");
+    passed &= check(duration.p999 >= 1.0 && duration.p999 < 1.13, "p99.9 catches the slow tail");
+    passed &= check(duration.max == 2.0, "max keeps the single spike");
+    passed &= check(snapshot.dspLoadPercent().max > 599.0, "DSP load relative to 0.33 ms period");
+    std::cout << std::endl;
+
+    // Test 3: Snapshots never tear
+    std::cout << "🔧 Test 3: Concurrent snapshots" << std::endl;
+    metrics.reset();
+    std::atomic<bool> writing(true);
+    std::thread writer([&]() {
+        std::uint64_t value = 1;
+        while (writing.load(std::memory_order_relaxed)) {
+            metrics.recordCallback(value++ % 500000, 0);
+        }
+    });
+
+    bool consistent = true;
+    for (int i = 0; i < 2000; ++i) {
+        Syntri::MetricsSnapshot s = metrics.snapshot();
+        std::uint64_t bucket_total = 0;
+        for (std::uint64_t count : s.callback_duration_ns.buckets) bucket_total += count;
+        consistent &= s.callback_count == s.callback_duration_ns.count &&
+            s.callback_count == s.dsp_load.count && bucket_total == s.callback_count;
+    }
+    writing = false;
+    writer.join();
+    passed &= check(consistent, "Every snapshot is internally consistent");
+    std::cout << std::endl;
+
+    // Test 4: Live stream metrics
+    std::cout << "🔧 Test 4: Stub interface snapshot" << std::endl;
+    auto stub = Syntri::createStubInterface();
+    auto processor = Syntri::createTestProcessor(false);
+    stub->initialize(Syntri::SAMPLE_RATE_96K, Syntri::BUFFER_SIZE_ULTRA_LOW);
+    stub->startStreaming(processor.get());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    Syntri::MetricsSnapshot live = stub->getMetricsSnapshot();
+    stub->stopStreaming();
+    Syntri::PercentileSummary jitter = live.wakeJitterMs();
+    std::cout << "  Callbacks " << live.callback_count << ", jitter p50 " << jitter.p50
+        << " ms, p99.9 " << jitter.p999 << " ms" << std::endl;
+    passed &= check(live.callback_count > 0, "Stub publishes live histograms");
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+// Syntri Real-Time Safety Test - Callback Violation Detection
+// Checks that allocation, locking and sleeping inside processAudio are caught, and clean callbacks are not
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/offline_interface.h"
+#include "syntri/rt_safety.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class Misbehaviour { NONE, ALLOCATE, LOCK, SLEEP, EXEMPT_ALLOCATE };
+
+class ProbeProcessor : public StubProcessor {
+private:
+    Misbehaviour misbehaviour_;
+    std::mutex mutex_;
+    std::vector<float> history_;
+
+public:
+    explicit ProbeProcessor(Misbehaviour misbehaviour) : misbehaviour_(misbehaviour) {}
+
+    bool usesAudioBlocks() const override { return true; }
+
+    void processAudio(const Syntri::ConstAudioBlock& inputs, const Syntri::AudioBlock& outputs) override {
+        switch (misbehaviour_) {
+        case Misbehaviour::ALLOCATE:
+            history_.push_back(inputs.getChannel(0)[0]);        // Grows -> reallocates
+            break;
+        case Misbehaviour::LOCK: {
+            std::lock_guard<std::mutex> lock(mutex_);
+            break;
+        }
+        case Misbehaviour::SLEEP:
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+            break;
+        case Misbehaviour::EXEMPT_ALLOCATE: {
+            Syntri::RealtimeSafetyExemption exemption;
+            history_.push_back(inputs.getChannel(0)[0]);
+            break;
+        }
+        case Misbehaviour::NONE:
+            break;
+        }
+        Syntri::copyBlock(inputs, outputs);
+    }
+};
+
+// Render ~20 blocks of silence through a probe and return the violations it caused
+static long long renderWith(Misbehaviour misbehaviour) {
+    Syntri::OfflineRenderOptions options;
+    options.num_input_channels = 2;
+    options.length_frames = 20 * Syntri::BUFFER_SIZE_LOW;
+    auto renderer = Syntri::createOfflineInterface(options);
+    renderer->initialize(Syntri::SAMPLE_RATE_48K, Syntri::BUFFER_SIZE_LOW);
+
+    ProbeProcessor processor(misbehaviour);
+    Syntri::resetRealtimeViolationCount();
+    renderer->render(&processor);
+    return Syntri::getRealtimeViolationCount();
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - REAL-TIME SAFETY TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    if (!Syntri::realtimeSafetyChecksInstalled()) {
+        std::cout << "Real-time safety checker not available on this platform - skipping" << std::endl;
+        long long violations = renderWith(Misbehaviour::ALLOCATE);
+        passed &= check(violations == 0, "Nothing is reported without the interposer");
+        return passed ? 0 : 1;
+    }
+    Syntri::setRealtimeViolationAction(Syntri::RealtimeViolationAction::REPORT);
+
+    // Test 1: A clean processor
+    std::cout << "🔧 Test 1: Real-time safe callback" << std::endl;
+    {
+        long long violations = renderWith(Misbehaviour::NONE);
+        passed &= check(violations == 0, "No violations from a clean processor");
+
+        Syntri::resetRealtimeViolationCount();
+        std::vector<int> outside(1024);
+        passed &= check(Syntri::getRealtimeViolationCount() == 0 && !Syntri::isInRealtimeCallback(),
+            "Allocation outside a callback is not flagged");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Each class of violation
+    std::cout << "🔧 Test 2: Violations are caught" << std::endl;
+    {
+        long long violations = renderWith(Misbehaviour::ALLOCATE);
+        std::cout << "  Allocating processor: " << violations << " violations (last: "
+            << Syntri::getLastRealtimeViolation() << ")" << std::endl;
+        passed &= check(violations > 0, "Allocation caught");
+
+        violations = renderWith(Misbehaviour::LOCK);
+        passed &= check(violations > 0 && std::strcmp(Syntri::getLastRealtimeViolation(), "pthread_mutex_lock") == 0,
+            "Mutex lock caught");
+
+        violations = renderWith(Misbehaviour::SLEEP);
+        passed &= check(violations > 0 && std::strstr(Syntri::getLastRealtimeViolation(), "nanosleep") != nullptr,
+            "Sleep caught");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Exemptions and nesting
+    std::cout << "🔧 Test 3: Exemptions" << std::endl;
+    {
+        long long violations = renderWith(Misbehaviour::EXEMPT_ALLOCATE);
+        passed &= check(violations == 0, "Exempted allocation not flagged");
+
+        Syntri::resetRealtimeViolationCount();
+        {
+            Syntri::RealtimeCallbackScope outer;
+            {
+                Syntri::RealtimeCallbackScope inner;
+            }
+            passed &= check(Syntri::isInRealtimeCallback(), "Nested scopes keep the outer scope active");
+        }
+        passed &= check(!Syntri::isInRealtimeCallback(), "Scope ends with the outermost guard");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
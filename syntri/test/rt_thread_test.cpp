@@ -0,0 +1,129 @@
+// Syntri Real-Time Thread Test - Audio Thread Setup Verification
+// Checks denormal flushing, scoped restore, pinning and graceful fallback without privileges
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/rt_thread.h"
+#include "syntri/audio_interface.h"
+#include "test_helpers.h"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+// Kept out of line so the multiply happens at run time under the current FP mode
+static volatile float denormal_input = std::numeric_limits<float>::denorm_min() * 64.0f;
+
+static bool denormalSurvives() {
+    volatile float result = denormal_input * 0.5f;
+    return result != 0.0f;
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - REAL-TIME THREAD TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    bool supported = false;
+
+    // Test 1: FTZ/DAZ on a fresh thread
+    std::cout << "🔧 Test 1: Denormal flushing" << std::endl;
+    {
+        bool before = true, after = true;
+        std::thread worker([&]() {
+            before = denormalSurvives();
+            supported = Syntri::enableDenormalFlush();
+            after = denormalSurvives();
+        });
+        worker.join();
+
+        passed &= check(before, "New threads start with IEEE denormals");
+        if (supported) {
+            passed &= check(!after, "Denormals flush to zero once enabled");
+        }
+        else {
+            std::cout << "  (Denormal control not available on this CPU)" << std::endl;
+        }
+    }
+    std::cout << std::endl;
+
+    // Test 2: ScopedDenormalFlush restores the caller's mode
+    std::cout << "🔧 Test 2: Scoped denormal flush" << std::endl;
+    {
+        bool inside = false, outside = false;
+        std::thread worker([&]() {
+            {
+                Syntri::ScopedDenormalFlush flush;
+                inside = Syntri::denormalFlushEnabled();
+            }
+            outside = Syntri::denormalFlushEnabled();
+        });
+        worker.join();
+
+        passed &= check(inside == supported, "Flush enabled inside the scope");
+        passed &= check(!outside, "Previous mode restored on exit");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Full setup degrades gracefully
+    std::cout << "🔧 Test 3: configureCurrentThreadForAudio" << std::endl;
+    {
+        Syntri::RealtimeThreadStatus status;
+        std::thread worker([&]() {
+            Syntri::RealtimeThreadOptions options;
+            options.cpu_affinity = { 0 };
+            options.prefault_stack_bytes = 64 * 1024;
+            status = Syntri::configureCurrentThreadForAudio(options);
+        });
+        worker.join();
+
+        std::cout << "  SCHED_FIFO: " << (status.realtime_priority ? "yes" : "no")
+            << " (priority " << status.priority << ")"
+            << ", pinned: " << (status.affinity_set ? "yes" : "no")
+            << ", locked: " << (status.memory_locked ? "yes" : "no") << std::endl;
+        if (!status.notes.empty()) {
+            std::cout << "  Notes: " << status.notes << std::endl;
+        }
+        passed &= check(status.configured && status.stack_prefaulted, "Setup ran to completion");
+        passed &= check(status.realtime_priority || !status.notes.empty(), "Missing privileges are reported, not fatal");
+        passed &= check(!status.realtime_priority || status.priority > 0, "Applied priority reported");
+#if defined(__linux__) || defined(_WIN32)
+        passed &= check(status.affinity_set, "Pinned to CPU 0");
+#endif
+    }
+    std::cout << std::endl;
+
+    // Test 4: Stub interface applies options to its audio thread
+    std::cout << "🔧 Test 4: Stub audio thread setup" << std::endl;
+    {
+        auto interface = Syntri::createStubInterface();
+        auto processor = Syntri::createTestProcessor(false);
+        interface->initialize(Syntri::SAMPLE_RATE_48K, Syntri::BUFFER_SIZE_LOW);
+
+        Syntri::RealtimeThreadOptions options;
+        options.lock_memory = false;
+        interface->setRealtimeThreadOptions(options);
+
+        passed &= check(!interface->getRealtimeThreadStatus().configured, "No status before streaming");
+        interface->startStreaming(processor.get());
+        // The thread may start late on a loaded machine - wait for it, not a fixed time
+        Syntri::RealtimeThreadStatus status = interface->getRealtimeThreadStatus();
+        for (int waited_ms = 0; !status.configured && waited_ms < 5000; waited_ms += 5) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            status = interface->getRealtimeThreadStatus();
+        }
+        interface->stopStreaming();
+        interface->shutdown();
+
+        passed &= check(status.configured, "Audio thread configured itself");
+        passed &= check(!status.memory_locked, "Memory locking honoured as disabled");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
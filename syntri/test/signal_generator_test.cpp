@@ -0,0 +1,182 @@
+// Syntri Signal Generator Test - Test Signal Verification
+// Checks sine phase accuracy, sweep tracking, noise statistics and impulse timing
+// Copyright (c) 2025 Syntri Technologies
+
+#define _USE_MATH_DEFINES  // Enable M_PI in MSVC
+#include <cmath>
+
+#include "syntri/signal_generator.h"
+#include "test_helpers.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - SIGNAL GENERATOR TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    const int rate = Syntri::SAMPLE_RATE_96K;
+
+    // Test 1: Sine accuracy over a long run in odd-sized blocks
+    std::cout << "🔧 Test 1: Rotator sine stays phase-accurate" << std::endl;
+    {
+        Syntri::SignalSettings settings;
+        settings.frequency = 997.0;
+        settings.amplitude = 0.5;
+        Syntri::SignalGenerator generator(settings);
+        generator.setSampleRate(rate);
+
+        const long long total = 60LL * rate;      // One minute
+        std::vector<float> block(37);
+        double worst = 0.0;
+        long long frame = 0;
+        while (frame < total) {
+            generator.render(block.data(), static_cast<int>(block.size()));
+            for (size_t i = 0; i < block.size(); ++i, ++frame) {
+                double expected = 0.5 * std::sin(std::fmod(2.0 * M_PI * 997.0 * frame / rate, 2.0 * M_PI));
+                worst = std::max(worst, std::fabs(block[i] - expected));
+            }
+        }
+        std::cout << "  Worst error after 60 s: " << worst << std::endl;
+        passed &= check(worst < 1.0e-5, "Matches std::sin to float precision with no drift");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Log sweep follows the closed-form phase
+    std::cout << "🔧 Test 2: Logarithmic sweep" << std::endl;
+    {
+        Syntri::SignalSettings settings;
+        settings.type = Syntri::SignalType::LOG_SWEEP;
+        settings.amplitude = 1.0;
+        settings.sweep_start_hz = 20.0;
+        settings.sweep_end_hz = 20000.0;
+        settings.sweep_seconds = 1.0;
+        Syntri::SignalGenerator generator(settings);
+        generator.setSampleRate(rate);
+
+        std::vector<float> output(rate + 1000);
+        for (size_t done = 0; done < output.size(); done += 50) {
+            generator.render(output.data() + done, static_cast<int>(std::min<size_t>(50, output.size() - done)));
+        }
+
+        const double k = std::log(1000.0);
+        double worst = 0.0;
+        for (int n = 0; n < rate; ++n) {
+            double t = static_cast<double>(n) / rate;
+            double expected = std::sin(2.0 * M_PI * 20.0 / k * std::expm1(t * k));
+            worst = std::max(worst, std::fabs(output[n] - expected));
+        }
+        std::cout << "  Worst error: " << worst << std::endl;
+        passed &= check(worst < 1.0e-4, "20 Hz -> 20 kHz sweep tracks the analytic signal");
+        passed &= check(std::fabs(output[rate] - 0.0f) < 1.0e-6, "Sweep restarts from zero phase");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Noise
+    std::cout << "🔧 Test 3: White and pink noise" << std::endl;
+    {
+        const int frames = 1 << 18;
+        std::vector<float> white(frames);
+        std::vector<float> pink(frames);
+
+        Syntri::SignalSettings settings;
+        settings.type = Syntri::SignalType::WHITE_NOISE;
+        settings.amplitude = 1.0;
+        Syntri::SignalGenerator white_generator(settings);
+        white_generator.render(white.data(), frames);
+
+        settings.type = Syntri::SignalType::PINK_NOISE;
+        Syntri::SignalGenerator pink_generator(settings);
+        pink_generator.render(pink.data(), frames);
+
+        auto stats = [&](const std::vector<float>& signal, double& mean, double& variance, double& diff_variance, float& peak) {
+            mean = variance = diff_variance = 0.0;
+            peak = 0.0f;
+            for (int i = 0; i < frames; ++i) mean += signal[i];
+            mean /= frames;
+            for (int i = 0; i < frames; ++i) {
+                variance += (signal[i] - mean) * (signal[i] - mean);
+                if (i > 0) diff_variance += (signal[i] - signal[i - 1]) * (signal[i] - signal[i - 1]);
+                peak = std::max(peak, std::fabs(signal[i]));
+            }
+            variance /= frames;
+            diff_variance /= frames;
+        };
+
+        double mean, variance, diff_variance;
+        float peak;
+        stats(white, mean, variance, diff_variance, peak);
+        passed &= check(std::fabs(mean) < 0.01 && std::fabs(variance - 1.0 / 3.0) < 0.01 && peak <= 1.0f,
+            "White noise is uniform in [-1, 1)");
+        passed &= check(std::fabs(diff_variance / variance - 2.0) < 0.05, "White noise is uncorrelated");
+
+        stats(pink, mean, variance, diff_variance, peak);
+        passed &= check(diff_variance / variance < 1.0, "Pink noise is low-frequency weighted");
+        passed &= check(peak > 0.2f && peak < 1.5f, "Pink noise peak is near the requested amplitude");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Impulse train and block fill
+    std::cout << "🔧 Test 4: Impulse train on a 64-channel block" << std::endl;
+    {
+        Syntri::SignalSettings settings;
+        settings.type = Syntri::SignalType::IMPULSE_TRAIN;
+        settings.frequency = 1000.0;
+        settings.amplitude = 1.0;
+        Syntri::SignalGenerator generator(settings);
+        generator.setSampleRate(rate);
+
+        Syntri::AudioBlockStorage storage(64, Syntri::BUFFER_SIZE_LOW);
+        std::vector<long long> positions;
+        bool all_channels = true;
+        for (int block = 0; block < 100; ++block) {
+            generator.render(storage.getBlock());
+            for (int sample = 0; sample < Syntri::BUFFER_SIZE_LOW; ++sample) {
+                if (storage.getBlock().getChannel(0)[sample] != 0.0f) {
+                    positions.push_back(static_cast<long long>(block) * Syntri::BUFFER_SIZE_LOW + sample);
+                }
+                all_channels &= storage.getBlock().getChannel(63)[sample] == storage.getBlock().getChannel(0)[sample];
+            }
+        }
+        bool spaced = positions.size() == 67 && positions[0] == 0;
+        for (size_t i = 1; spaced && i < positions.size(); ++i) spaced = positions[i] - positions[i - 1] == 96;
+        passed &= check(spaced, "One click every 96 samples at 1 kHz / 96 kHz");
+        passed &= check(all_channels, "Every channel carries the same signal");
+    }
+    std::cout << std::endl;
+
+    // Test 5: Cost (informational)
+    std::cout << "🔧 Test 5: Sine cost vs. per-sample std::sin" << std::endl;
+    {
+        Syntri::SignalGenerator generator;
+        generator.setSampleRate(rate);
+        Syntri::AudioBlockStorage storage(64, Syntri::BUFFER_SIZE_LOW);
+
+        const int iterations = 20000;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) generator.render(storage.getBlock().getChannel(0), Syntri::BUFFER_SIZE_LOW);
+        double rotator_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+        double phase = 0.0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            for (int sample = 0; sample < Syntri::BUFFER_SIZE_LOW; ++sample) {
+                storage.getBlock().getChannel(0)[sample] = static_cast<float>(0.1 * std::sin(phase));
+                phase += 2.0 * M_PI * 440.0 / rate;
+            }
+        }
+        double sin_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+        std::cout << "  Rotator: " << rotator_us << " us per 64 frames, std::sin: " << sin_us << " us" << std::endl;
+        passed &= check(rotator_us > 0.0 && sin_us > 0.0, "Timings measured");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,300 @@
+// Syntri Stub Interface Test - Deadline and Xrun Recovery Verification
+// Checks stall and overload detection, recovery output, virtual time, live reconfiguration and processor swaps
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/stub_interface.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// First and last sample of channel 0 for each played period
+struct PlayedPeriod {
+    float first;
+    float last;
+    int frames;
+    bool recovered;
+};
+
+struct TapLog {
+    std::vector<PlayedPeriod> periods;
+
+    TapLog() { periods.reserve(4096); }
+
+    Syntri::StubOutputTap tap() {
+        return [this](const Syntri::ConstAudioBlock& played, bool recovered) {
+            if (periods.size() < periods.capacity()) {
+                const float* samples = played.getChannel(0);
+                periods.push_back({ samples[0], samples[played.getNumFrames() - 1], played.getNumFrames(), recovered });
+            }
+        };
+    }
+
+    // Index of the first recovered period, or -1
+    int firstRecovery() const {
+        for (size_t i = 0; i < periods.size(); ++i) {
+            if (periods[i].recovered) return static_cast<int>(i);
+        }
+        return -1;
+    }
+};
+
+static Syntri::RealtimeThreadOptions normalPriority() {
+    Syntri::RealtimeThreadOptions options;
+    options.use_realtime_priority = false;   // Injected overload must not starve the test thread
+    options.lock_memory = false;
+    return options;
+}
+
+// Stream, stall one callback, stream a little more - in virtual time, so
+// the counts do not depend on how busy the host is
+static void runWithStall(Syntri::StubInterfaceOptions options, Syntri::AudioProcessor& processor) {
+    options.virtual_time = true;
+    Syntri::StubAudioInterface stub(options);
+    stub.initialize(48000, 256);
+    stub.startStreaming(&processor);
+    stub.stepBuffers(4);
+    stub.injectStall(20000000);
+    stub.stepBuffers(8);
+    stub.stopStreaming();
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - STUB INTERFACE TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+    DcProcessor processor;
+
+    // Test 1: Stall detection
+    std::cout << "🔧 Test 1: Stalled callback counts as an underrun" << std::endl;
+    {
+        TapLog log;
+        Syntri::StubInterfaceOptions options;
+        options.output_tap = log.tap();
+        runWithStall(options, processor);
+
+        // The late callback plus the three boundaries it slept through
+        int recovered = 0;
+        for (const PlayedPeriod& period : log.periods) recovered += period.recovered ? 1 : 0;
+        std::cout << "  Periods: " << log.periods.size() << ", recovered: " << recovered << std::endl;
+        passed &= check(log.periods.size() == 15, "Every callback and skipped boundary plays");
+        passed &= check(recovered == 4, "A 20 ms stall misses four 5.3 ms periods");
+        passed &= check(log.firstRecovery() == 4, "Recovery follows on-time periods");
+        passed &= check(!log.periods.empty() && !log.periods.back().recovered, "Fresh output resumes after the stall");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Overload
+    std::cout << "🔧 Test 2: Injected load" << std::endl;
+    {
+        Syntri::StubInterfaceOptions options;
+        options.virtual_time = true;
+        Syntri::StubAudioInterface stub(options);
+        stub.initialize(48000, 256);
+        stub.setInjectedLoad(0.3);
+        stub.startStreaming(&processor);
+        stub.stepBuffers(10);
+        Syntri::MetricsSnapshot light = stub.getMetricsSnapshot();
+
+        stub.setInjectedLoad(1.5);
+        stub.stepBuffers(10);
+        stub.stopStreaming();
+        Syntri::MetricsSnapshot heavy = stub.getMetricsSnapshot();
+
+        std::cout << "  Mean DSP load at 30%: " << light.dspLoadPercent().mean << "%" << std::endl;
+        passed &= check(light.xrun_count == 0 && light.dspLoadPercent().mean > 29.9 && light.dspLoadPercent().mean < 30.1,
+            "Load shows up as DSP load");
+        passed &= check(heavy.xrun_count >= 10, "150% load underruns continuously");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Recovery output
+    std::cout << "🔧 Test 3: Recovery modes" << std::endl;
+    {
+        TapLog silence_log;
+        Syntri::StubInterfaceOptions silence_options;
+        silence_options.recovery = Syntri::XrunRecovery::SILENCE;
+        silence_options.output_tap = silence_log.tap();
+        runWithStall(silence_options, processor);
+        int index = silence_log.firstRecovery();
+        passed &= check(index > 0 && silence_log.periods[index].first == 0.0f && silence_log.periods[index].last == 0.0f,
+            "Silence plays zeros");
+
+        TapLog repeat_log;
+        Syntri::StubInterfaceOptions repeat_options;
+        repeat_options.recovery = Syntri::XrunRecovery::REPEAT_LAST;
+        repeat_options.output_tap = repeat_log.tap();
+        runWithStall(repeat_options, processor);
+        index = repeat_log.firstRecovery();
+        passed &= check(index > 0 && repeat_log.periods[index].first == 1.0f && repeat_log.periods[index].last == 1.0f,
+            "Repeat plays the last good buffer");
+
+        TapLog fade_log;
+        Syntri::StubInterfaceOptions fade_options;
+        fade_options.recovery = Syntri::XrunRecovery::CROSSFADE;
+        fade_options.output_tap = fade_log.tap();
+        runWithStall(fade_options, processor);
+        index = fade_log.firstRecovery();
+        bool fades_out = index > 0 && fade_log.periods[index].first > 0.99f && fade_log.periods[index].last < 0.01f;
+        bool fades_in = false;
+        for (size_t i = static_cast<size_t>(std::max(index, 0)); i + 1 < fade_log.periods.size(); ++i) {
+            if (fade_log.periods[i].recovered && !fade_log.periods[i + 1].recovered) {
+                fades_in = fade_log.periods[i + 1].first < 0.01f && fade_log.periods[i + 1].last > 0.99f;
+                break;
+            }
+        }
+        passed &= check(fades_out, "Crossfade ramps the last good buffer down");
+        passed &= check(fades_in, "Crossfade ramps fresh audio back up");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Virtual time
+    std::cout << "🔧 Test 4: Virtual-time stepping" << std::endl;
+    {
+        TapLog log;
+        Syntri::StubInterfaceOptions options;
+        options.virtual_time = true;
+        options.output_tap = log.tap();
+        Syntri::StubAudioInterface stub(options);
+        stub.initialize(48000, 256);
+        passed &= check(stub.stepBuffers(1) == 0, "Stepping needs streaming");
+        stub.startStreaming(&processor);
+
+        // Ten seconds of audio must not take ten seconds
+        auto wall_start = std::chrono::steady_clock::now();
+        int stepped = stub.stepBuffers(1875);
+        double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall_start).count();
+        std::cout << "  10 s of buffers stepped in " << wall_ms << " ms" << std::endl;
+        passed &= check(stepped == 1875 && stub.getMetricsSnapshot().callback_count == 1875, "Every step is one callback");
+        passed &= check(stub.getVirtualTimeNanoseconds() == 10000000000ULL, "Simulated clock sits on the 10 s boundary");
+        passed &= check(wall_ms < 5000.0, "Faster than real time");
+
+        // 20 ms stall at 5.33 ms periods: the late callback plus three skipped boundaries
+        stub.injectStall(20000000);
+        stub.stepBuffers(4);
+        Syntri::MetricsSnapshot stalled = stub.getMetricsSnapshot();
+        passed &= check(stalled.xrun_count == 4, "Stall underruns are exact");
+        passed &= check(!log.periods.empty() && !log.periods.back().recovered, "Fresh output resumes after the stall");
+
+        // 150% load misses every deadline, 50% none
+        stub.setInjectedLoad(1.5);
+        stub.stepBuffers(10);
+        passed &= check(stub.getMetricsSnapshot().xrun_count > stalled.xrun_count + 10, "Overload underruns every period");
+        Syntri::MetricsSnapshot overloaded = stub.getMetricsSnapshot();
+        stub.setInjectedLoad(0.5);
+        stub.stepBuffers(10);
+        passed &= check(stub.getMetricsSnapshot().xrun_count == overloaded.xrun_count, "Half load fits the period");
+        stub.stopStreaming();
+    }
+    std::cout << std::endl;
+
+    // Test 5: Live reconfiguration
+    std::cout << "🔧 Test 5: Live buffer size switch" << std::endl;
+    {
+        TapLog log;
+        Syntri::StubInterfaceOptions options;
+        options.virtual_time = true;
+        options.output_tap = log.tap();
+        Syntri::StubAudioInterface stub(options);
+        stub.initialize(48000, 64);
+        stub.startStreaming(&processor);
+        stub.stepBuffers(100);
+
+        size_t before = log.periods.size();
+        bool switched = stub.reconfigure(48000, 32);
+        stub.stepBuffers(100);
+        stub.stopStreaming();
+
+        passed &= check(switched && processor.buffer_size == 32, "setupChanged sees the new size");
+        passed &= check(stub.getMetricsSnapshot().xrun_count == 0 && log.firstRecovery() < 0, "No underruns across the switch");
+        passed &= check(stub.getCurrentLatency() < 0.7, "Latency follows the new size");
+        bool faded = log.periods.size() > before + 1 &&
+            log.periods[before].frames == 64 && log.periods[before].first > 0.95f && log.periods[before].last < 0.05f &&
+            log.periods[before + 1].frames == 32 && log.periods[before + 1].first < 0.05f && log.periods[before + 1].last > 0.95f;
+        passed &= check(faded, "Old size fades out, new size fades in");
+        passed &= check(log.periods.back().frames == 32 && log.periods.back().first == 1.0f, "Full level at the new size");
+    }
+    {
+        TapLog log;
+        Syntri::StubInterfaceOptions options;
+        options.output_tap = log.tap();
+        Syntri::StubAudioInterface stub(options);
+        stub.setRealtimeThreadOptions(normalPriority());
+        stub.initialize(48000, 256);
+        stub.startStreaming(&processor);
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        bool switched = stub.reconfigure(48000, 128);
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        stub.stopStreaming();
+
+        passed &= check(switched && !log.periods.empty() && log.periods.back().frames == 128,
+            "Audio thread switches while streaming");
+        passed &= check(stub.reconfigure(44100, 64) && stub.getCurrentLatency() < 1.5, "Stopped interface just takes the new size");
+    }
+    std::cout << std::endl;
+
+    // Test 6: Processor swap
+    std::cout << "🔧 Test 6: Processor hot swap" << std::endl;
+    {
+        TapLog log;
+        Syntri::StubInterfaceOptions options;
+        options.virtual_time = true;
+        options.output_tap = log.tap();
+        Syntri::StubAudioInterface stub(options);
+        DcProcessor first(1.0f);
+        DcProcessor second(0.5f);
+        DcProcessor third(0.25f);
+        stub.initialize(48000, 64);
+        stub.startStreaming(&first);
+        stub.stepBuffers(10);
+
+        // 96-frame crossfade spans a period and a half
+        size_t before = log.periods.size();
+        Syntri::AudioProcessor* retired = stub.swapProcessor(&second, 96);
+        int first_calls = first.calls;
+        stub.stepBuffers(10);
+        passed &= check(retired == &first && second.buffer_size == 64, "Old processor comes back, new one was prepared");
+        passed &= check(first.calls == first_calls, "Retired processor is never called again");
+        bool crossfaded = log.periods.size() > before + 2 &&
+            log.periods[before].first == 1.0f && log.periods[before].last < 1.0f && log.periods[before].last > 0.6f &&
+            log.periods[before + 1].first < 0.7f && log.periods[before + 1].last == 0.5f &&
+            log.periods[before + 2].first == 0.5f;
+        passed &= check(crossfaded, "Output crossfades from the old level to the new");
+
+        before = log.periods.size();
+        retired = stub.swapProcessor(&third);
+        stub.stepBuffers(2);
+        passed &= check(retired == &second && log.periods[before].first == 0.25f, "Zero crossfade switches on the boundary");
+        passed &= check(stub.getMetricsSnapshot().xrun_count == 0, "No underruns across swaps");
+        stub.stopStreaming();
+        passed &= check(stub.swapProcessor(&first) == nullptr, "Swapping needs a running stream");
+    }
+    {
+        Syntri::StubAudioInterface stub;
+        DcProcessor first(1.0f);
+        DcProcessor second(0.5f);
+        stub.setRealtimeThreadOptions(normalPriority());
+        stub.initialize(48000, 128);
+        stub.startStreaming(&first);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        Syntri::AudioProcessor* retired = stub.swapProcessor(&second, 512);
+        int first_calls = first.calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        stub.stopStreaming();
+        passed &= check(retired == &first && first.calls == first_calls && second.calls > 0,
+            "Audio thread hands the old processor back after the crossfade");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+// test/test_helpers.h
+// Shared check() and stub processors for the unit tests
+#pragma once
+
+#include "syntri/audio_interface.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+// Prints one ✅/❌ line; tests and the result into `passed`
+inline bool check(bool condition, const char* description) {
+    std::cout << (condition ? "  ✅ " : "  ❌ ") << description << std::endl;
+    return condition;
+}
+
+// Base for test processors - remembers the last setupChanged()
+class StubProcessor : public Syntri::AudioProcessor {
+public:
+    using AudioProcessor::processAudio;
+
+    void setupChanged(int new_sample_rate, int new_buffer_size) override {
+        sample_rate = new_sample_rate;
+        buffer_size = new_buffer_size;
+    }
+
+    int sample_rate = 0;
+    int buffer_size = 0;
+};
+
+// Planar callback: each output channel is its input times `gain`, silence
+// where there is no input
+class GainProcessor : public StubProcessor {
+public:
+    explicit GainProcessor(float gain_factor = 1.0f) : gain(gain_factor) {}
+
+    void processAudio(const Syntri::ConstAudioBlock& inputs, const Syntri::AudioBlock& outputs) override {
+        for (int ch = 0; ch < outputs.getNumChannels(); ++ch) {
+            for (int i = 0; i < outputs.getNumFrames(); ++i) {
+                outputs.getChannel(ch)[i] = ch < inputs.getNumChannels() ? inputs.getChannel(ch)[i] * gain : 0.0f;
+            }
+        }
+    }
+
+    bool usesAudioBlocks() const override { return true; }
+
+    float gain;
+};
+
+// The same through the MultiChannelBuffer callback only
+class LegacyGainProcessor : public StubProcessor {
+public:
+    explicit LegacyGainProcessor(float gain_factor = 1.0f) : gain(gain_factor) {}
+
+    void processAudio(const Syntri::MultiChannelBuffer& inputs, Syntri::MultiChannelBuffer& outputs, int num_samples) override {
+        for (size_t ch = 0; ch < outputs.size(); ++ch) {
+            for (int i = 0; i < num_samples; ++i) {
+                outputs[ch][i] = ch < inputs.size() ? inputs[ch][i] * gain : 0.0f;
+            }
+        }
+    }
+
+    float gain;
+};
+
+// Constant `level` on every output channel, counting callbacks
+class DcProcessor : public StubProcessor {
+public:
+    explicit DcProcessor(float dc_level = 1.0f) : level(dc_level) {}
+
+    void processAudio(const Syntri::ConstAudioBlock&, const Syntri::AudioBlock& outputs) override {
+        for (int ch = 0; ch < outputs.getNumChannels(); ++ch) {
+            std::fill_n(outputs.getChannel(ch), outputs.getNumFrames(), level);
+        }
+        calls++;
+    }
+
+    float level;
+    std::atomic<int> calls{ 0 };
+};
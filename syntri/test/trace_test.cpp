@@ -0,0 +1,136 @@
+// Syntri Trace Test - Timeline Tracing Verification
+// Checks span capture, ring overwrite, worker-task spans and Chrome JSON export
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/trace.h"
+#include "syntri/rt_safety.h"
+#include "syntri/worker_pool.h"
+#include "test_helpers.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int countNamed(const std::vector<Syntri::TraceEvent>& events, const std::string& name) {
+    int count = 0;
+    for (const auto& event : events) {
+        if (name == event.name) count++;
+    }
+    return count;
+}
+
+static void emptyTask(void*, int) {}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - TIMELINE TRACE TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    // Test 1: Spans
+    std::cout << "🔧 Test 1: Scoped spans" << std::endl;
+    {
+        {
+            Syntri::TraceScope ignored("before_start");
+        }
+        Syntri::startTracing(1024);
+        Syntri::setTraceThreadName("Test main");
+        {
+            Syntri::TraceScope outer("outer", 7);
+            Syntri::TraceScope inner("inner");
+        }
+        Syntri::stopTracing();
+        {
+            Syntri::TraceScope ignored("after_stop");
+        }
+
+        auto events = Syntri::getTraceEvents();
+        passed &= check(events.size() == 2, "Only spans recorded while tracing");
+        passed &= check(events.size() == 2 && std::string(events[0].name) == "outer" && events[0].arg == 7 &&
+            events[1].start_ns >= events[0].start_ns &&
+            events[1].start_ns + events[1].duration_ns <= events[0].start_ns + events[0].duration_ns,
+            "Nested span lies inside its parent");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Ring behaviour
+    std::cout << "🔧 Test 2: Ring overwrite and clear" << std::endl;
+    {
+        Syntri::startTracing(1024);
+        for (int i = 0; i < 5000; ++i) {
+            Syntri::TraceScope span("loop", i);
+        }
+        auto events = Syntri::getTraceEvents();
+        passed &= check(events.size() == 1024 && events.back().arg == 4999 && events.front().arg == 5000 - 1024,
+            "Keeps the newest spans, oldest first");
+
+        Syntri::clearTrace();
+        passed &= check(Syntri::getTraceEvents().empty(), "Clear discards recorded spans");
+
+        Syntri::resetRealtimeViolationCount();
+        {
+            Syntri::RealtimeCallbackScope callback;
+            Syntri::TraceScope span("in_callback");
+        }
+        if (Syntri::realtimeSafetyChecksInstalled()) {
+            passed &= check(Syntri::getRealtimeViolationCount() == 0, "Recording is real-time safe");
+        }
+        Syntri::stopTracing();
+    }
+    std::cout << std::endl;
+
+    // Test 3: Concurrent writers
+    std::cout << "🔧 Test 3: Worker pool task spans" << std::endl;
+    {
+        Syntri::WorkerPoolOptions options;
+        options.num_workers = 2;
+        options.use_isolated_cpus = false;
+        Syntri::RealtimeWorkerPool pool(options);
+
+        Syntri::startTracing();
+        Syntri::clearTrace();
+        for (int batch = 0; batch < 50; ++batch) {
+            Syntri::TraceScope callback("callback", batch);
+            pool.run(16, emptyTask, nullptr);
+        }
+        Syntri::stopTracing();
+
+        auto events = Syntri::getTraceEvents();
+        passed &= check(countNamed(events, "callback") == 50, "One span per callback");
+        passed &= check(countNamed(events, "worker_task") == 50 * 16, "One span per worker task");
+    }
+    std::cout << std::endl;
+
+    // Test 4: Export
+    std::cout << "🔧 Test 4: Chrome trace export" << std::endl;
+    {
+        const std::string path = "syntri_trace_test.json";
+        std::string error;
+        bool written = Syntri::writeChromeTrace(path, error);
+
+        std::ifstream file(path);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        const std::string json = contents.str();
+
+        passed &= check(written, "Trace file written");
+        passed &= check(json.rfind("{\"displayTimeUnit\"", 0) == 0 && json.find("\"traceEvents\":[") != std::string::npos &&
+            json.find("]}") != std::string::npos, "Trace-event JSON envelope");
+        passed &= check(json.find("\"ph\":\"X\"") != std::string::npos && json.find("\"name\":\"worker_task\"") != std::string::npos,
+            "Complete events carry span names");
+        passed &= check(json.find("\"name\":\"DSP worker 0\"") != std::string::npos, "Worker threads are named");
+        std::remove(path.c_str());
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+// Syntri Worker Pool Test - Parallel Mix Rendering Verification
+// Checks exactly-once execution under stealing, deadline reporting,
+// that parallel mixer output matches single-threaded rendering and that
+// the mixer is timed against the callback deadline
+// Copyright (c) 2025 Syntri Technologies
+
+#include "syntri/worker_pool.h"
+#include "syntri/matrix_mixer.h"
+#include "test_helpers.h"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+struct CountingJob {
+    std::vector<std::atomic<int>>* counts;
+};
+
+static void countTask(void* context, int index) {
+    auto* job = static_cast<CountingJob*>(context);
+    // Uneven cost so stealing actually happens
+    volatile int spin = (index % 7) * 200;
+    while (spin > 0) spin = spin - 1;
+    (*job->counts)[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+int main() {
+    std::cout << "=====================================" << std::endl;
+    std::cout << "    SYNTRI - WORKER POOL TEST" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = true;
+
+    Syntri::WorkerPoolOptions options;
+    options.num_workers = 3;
+    options.use_isolated_cpus = false;
+    options.park_after_idle_ms = 5.0;
+    Syntri::RealtimeWorkerPool pool(options);
+
+    // Test 1: Exactly-once execution
+    std::cout << "🔧 Test 1: Every task runs exactly once" << std::endl;
+    {
+        const int batches = 300;
+        const int tasks = 37;
+        std::vector<std::atomic<int>> counts(tasks);
+        for (auto& count : counts) count = 0;
+        CountingJob job{ &counts };
+
+        for (int batch = 0; batch < batches; ++batch) {
+            pool.run(tasks, countTask, &job);
+        }
+
+        bool exact = true;
+        for (auto& count : counts) exact &= count.load() == batches;
+        passed &= check(exact, "300 batches x 37 tasks, no task lost or repeated");
+    }
+    std::cout << std::endl;
+
+    // Test 2: Deadline reporting and wake-up after parking
+    std::cout << "🔧 Test 2: Deadlines and parked workers" << std::endl;
+    {
+        std::vector<std::atomic<int>> counts(8);
+        for (auto& count : counts) count = 0;
+        CountingJob job{ &counts };
+
+        bool late = pool.run(8, countTask, &job, Syntri::readClockTicks() - Syntri::nanosecondsToClockTicks(1000000));
+        passed &= check(!late && pool.getDeadlineMisses() == 1, "Batch finishing after its deadline is reported");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));     // Let the workers park
+        bool on_time = pool.run(8, countTask, &job, Syntri::readClockTicks() + Syntri::nanosecondsToClockTicks(1000000000));
+        bool all_ran = true;
+        for (auto& count : counts) all_ran &= count.load() == 2;
+        passed &= check(on_time && all_ran, "Parked workers rejoin the next batch");
+    }
+    std::cout << std::endl;
+
+    // Test 3: Parallel mixer output
+    std::cout << "🔧 Test 3: Parallel matrix mixer" << std::endl;
+    {
+        const int frames = Syntri::BUFFER_SIZE_LOW;
+        Syntri::MatrixMixer serial(16, 8);
+        Syntri::MatrixMixer parallel(16, 8);
+        parallel.setWorkerPool(&pool);
+
+        for (Syntri::MatrixMixer* mixer : { &serial, &parallel }) {
+            mixer->setupChanged(Syntri::SAMPLE_RATE_96K, frames);
+            for (int mix = 0; mix < 8; ++mix) {
+                for (int input = 0; input < 16; ++input) {
+                    mixer->setGain(input, mix, 0.05f * ((input + mix) % 5));
+                    mixer->setPan(input, mix, (input % 3) - 1.0f);
+                }
+            }
+        }
+
+        Syntri::AudioBlockStorage inputs(16, frames);
+        Syntri::AudioBlockStorage serial_out(16, frames);
+        Syntri::AudioBlockStorage parallel_out(16, frames);
+        for (int ch = 0; ch < 16; ++ch) {
+            for (int sample = 0; sample < frames; ++sample) {
+                inputs.getBlock().getChannel(ch)[sample] = static_cast<float>((ch * 31 + sample) % 17) / 17.0f;
+            }
+        }
+
+        bool identical = true;
+        for (int block = 0; block < 50; ++block) {
+            serial.processAudio(inputs.getBlock(), serial_out.getBlock());
+            parallel.processAudio(inputs.getBlock(), parallel_out.getBlock());
+            for (int ch = 0; ch < 16; ++ch) {
+                for (int sample = 0; sample < frames; ++sample) {
+                    identical &= serial_out.getBlock().getChannel(ch)[sample] ==
+                        parallel_out.getBlock().getChannel(ch)[sample];
+                }
+            }
+        }
+        passed &= check(identical, "Parallel rendering is bit-identical to serial");
+    }
+    std::cout << std::endl;
+
+    // Test 4: The mixer measures against the interface's deadline, not its own start
+    std::cout << "🔧 Test 4: Callback deadline" << std::endl;
+    {
+        Syntri::MatrixMixer mixer(8, 4);
+        mixer.setWorkerPool(&pool);
+        Syntri::AudioBlockStorage inputs(8, Syntri::BUFFER_SIZE_ULTRA_LOW);
+        Syntri::AudioBlockStorage outputs(8, Syntri::BUFFER_SIZE_ULTRA_LOW);
+        Syntri::LegacyProcessorBridge bridge;
+
+        const long long misses_before = pool.getDeadlineMisses();
+        Syntri::invokeProcessor(mixer, bridge, inputs.getBlock(), outputs.getBlock());
+        passed &= check(pool.getDeadlineMisses() == misses_before, "No deadline, no miss");
+
+        const std::uint64_t passed_deadline = Syntri::readClockTicks() - Syntri::nanosecondsToClockTicks(1000000);
+        Syntri::invokeProcessor(mixer, bridge, inputs.getBlock(), outputs.getBlock(), passed_deadline);
+        passed &= check(pool.getDeadlineMisses() == misses_before + 1, "Callback deadline already spent before the mixer is a miss");
+        passed &= check(Syntri::getCallbackDeadlineTicks() == 0, "Deadline is cleared after the callback");
+    }
+    std::cout << std::endl;
+
+    // Test 5: A burst of sample-accurate commands still fans out once
+    std::cout << "🔧 Test 5: Command bursts" << std::endl;
+    {
+        const int frames = Syntri::BUFFER_SIZE_ULTRA_LOW;
+        Syntri::MatrixMixer serial(8, 4);
+        Syntri::MatrixMixer parallel(8, 4);
+        parallel.setWorkerPool(&pool);
+
+        for (Syntri::MatrixMixer* mixer : { &serial, &parallel }) {
+            mixer->setupChanged(Syntri::SAMPLE_RATE_96K, frames);
+            for (int mix = 0; mix < 4; ++mix) {
+                for (int input = 0; input < 8; ++input) mixer->setGain(input, mix, 0.25f);
+            }
+            mixer->snapToTargets();
+            for (int command = 0; command < 100; ++command) {
+                Syntri::MixerCommand move;
+                move.input = command % 8;
+                move.mix = command % 4;
+                move.value = 0.01f * command;
+                move.sample_offset = command % frames;
+                mixer->postCommand(move);
+            }
+        }
+
+        Syntri::AudioBlockStorage inputs(8, frames);
+        for (int ch = 0; ch < 8; ++ch) {
+            for (int sample = 0; sample < frames; ++sample) inputs.getBlock().getChannel(ch)[sample] = 0.1f * (ch + 1);
+        }
+        Syntri::AudioBlockStorage serial_out(8, frames);
+        Syntri::AudioBlockStorage parallel_out(8, frames);
+        Syntri::LegacyProcessorBridge bridge;
+
+        const long long misses_before = pool.getDeadlineMisses();
+        const std::uint64_t passed_deadline = Syntri::readClockTicks() - Syntri::nanosecondsToClockTicks(1000000);
+        serial.processAudio(inputs.getBlock(), serial_out.getBlock());
+        Syntri::invokeProcessor(parallel, bridge, inputs.getBlock(), parallel_out.getBlock(), passed_deadline);
+
+        bool identical = true;
+        for (int ch = 0; ch < 8; ++ch) {
+            for (int sample = 0; sample < frames; ++sample) {
+                identical &= serial_out.getBlock().getChannel(ch)[sample] == parallel_out.getBlock().getChannel(ch)[sample];
+            }
+        }
+        passed &= check(identical, "100 commands across 32 frames match serial rendering");
+        passed &= check(pool.getDeadlineMisses() == misses_before + 1, "One pool batch for the whole block");
+    }
+    std::cout << std::endl;
+
+    std::cout << "=====================================" << std::endl;
+    std::cout << (passed ? "    🎉 ALL TESTS PASSED! 🎉" : "    ❌ SOME TESTS FAILED") << std::endl;
+    std::cout << "=====================================" << std::endl;
+
+    return passed ? 0 : 1;
+}